@@ -1748,6 +1748,37 @@ static MDEV RAM_PAGE    =   {TRUE,  FALSE,  NULL};  /* this makes a page RAM
 static MDEV EMPTY_PAGE  =   {FALSE, TRUE,   NULL};  /* this is non-existing memory  */
 static MDEV mmu_table[MAXMEMORY >> LOG2PAGESIZE];
 
+/* While sim_instr_mmu runs, mmu_rdmap and mmu_wrmap hold for each page of the 64KB address
+   space as currently banked a host pointer to the page in M, or NULL when the access must go
+   through mmu_table (memory mapped I/O, non existing memory, writes to ROM, or a page which
+   contains the start of common memory). Outside of sim_instr_mmu all entries are NULL. */
+static uint8 *mmu_rdmap[MAXBANKSIZE >> LOG2PAGESIZE];
+static uint8 *mmu_wrmap[MAXBANKSIZE >> LOG2PAGESIZE];
+static t_bool mmu_map_active = FALSE;
+
+static void mmu_map_update(void) {
+    uint32 page, addr;
+    MDEV m;
+
+    for (page = 0; page < (MAXBANKSIZE >> LOG2PAGESIZE); page++) {
+        mmu_rdmap[page] = mmu_wrmap[page] = NULL;
+        if (!mmu_map_active)
+            continue;
+        addr = page << LOG2PAGESIZE;
+        if (cpu_unit.flags & UNIT_CPU_BANKED) {
+            if ((addr < common) && (common < addr + PAGESIZE))
+                continue;   /* page straddles common memory boundary */
+            if (addr < common)
+                addr |= bankSelect << MAXBANKSIZELOG2;
+        }
+        m = mmu_table[addr >> LOG2PAGESIZE];
+        if (m.isRAM)
+            mmu_rdmap[page] = mmu_wrmap[page] = M + addr;
+        else if ((m.routine == NULL) && !m.isEmpty)
+            mmu_rdmap[page] = M + addr; /* ROM */
+    }
+}
+
 /* Memory and I/O Resource Mapping and Unmapping routine. */
 uint32 sim_map_resource(uint32 baseaddr, uint32 size, uint32 resource_type,
         int32 (*routine)(const int32, const int32, const int32), uint8 unmap) {
@@ -1777,6 +1808,8 @@ uint32 sim_map_resource(uint32 baseaddr, uint32 size, uint32 resource_type,
                 mmu_table[page].routine = routine;
             }
         }
+        if (mmu_map_active)
+            mmu_map_update();
     } else if (resource_type == RESOURCE_TYPE_IO) {
         for (i = baseaddr; i < baseaddr + size; i++)
             if (unmap) {
@@ -1800,8 +1833,13 @@ uint32 sim_map_resource(uint32 baseaddr, uint32 size, uint32 resource_type,
 
 static void PutBYTE(register uint32 Addr, const register uint32 Value) {
     MDEV m;
+    uint8 *p;
 
     Addr &= ADDRMASK;   /* registers are NOT guaranteed to be always 16-bit values */
+    if ((p = mmu_wrmap[Addr >> LOG2PAGESIZE])) {
+        p[Addr & (PAGESIZE - 1)] = Value;
+        return;
+    }
     if ((cpu_unit.flags & UNIT_CPU_BANKED) && (Addr < common))
         Addr |= bankSelect << MAXBANKSIZELOG2;
     m = mmu_table[Addr >> LOG2PAGESIZE];
@@ -1843,8 +1881,11 @@ static void PutWORD(register uint32 Addr, const register uint32 Value) {
 
 static uint32 GetBYTE(register uint32 Addr) {
     MDEV m;
+    uint8 *p;
 
     Addr &= ADDRMASK;   /* registers are NOT guaranteed to be always 16-bit values */
+    if ((p = mmu_rdmap[Addr >> LOG2PAGESIZE]))
+        return p[Addr & (PAGESIZE - 1)];
     if ((cpu_unit.flags & UNIT_CPU_BANKED) && (Addr < common))
         Addr |= bankSelect << MAXBANKSIZELOG2;
     m = mmu_table[Addr >> LOG2PAGESIZE];
@@ -1884,7 +1925,11 @@ int32 getBankSelect(void) {
 }
 
 void setBankSelect(const int32 b) {
+    if (b == bankSelect)
+        return;
     bankSelect = b;
+    if (mmu_map_active)
+        mmu_map_update();
 }
 
 uint32 getCommon(void) {
@@ -2023,7 +2068,15 @@ t_stat sim_instr (void) {
         result = sim_instr_m68k();
     } else if ((chiptype == CHIP_TYPE_8086) || (cpu_unit.flags & UNIT_CPU_MMU))
         do {
-            result = (chiptype == CHIP_TYPE_8086) ? sim_instr_8086() : sim_instr_mmu();
+            if (chiptype == CHIP_TYPE_8086)
+                result = sim_instr_8086();
+            else {
+                mmu_map_active = TRUE;
+                mmu_map_update();
+                result = sim_instr_mmu();
+                mmu_map_active = FALSE;
+                mmu_map_update();
+            }
         } while (switch_cpu_now == FALSE);
     else {
         uint32 i;
@@ -6614,6 +6667,8 @@ t_stat install_bootrom(const int32 bootrom[], const int32 size, const int32 addr
             mmu_table[(i + addr) >> LOG2PAGESIZE] = ROM_PAGE;
         M[i + addr] = bootrom[i] & 0xff;
     }
+    if (mmu_map_active)
+        mmu_map_update();
     return SCPE_OK;
 }
 
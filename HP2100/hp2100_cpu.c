@@ -2114,11 +2114,26 @@ else
    eligible to interrupt (memory protect shares SC 05, but qualification occurs
    in the MP abort handler, so if SC 05 is interrupting when ION is clear, it
    must be a parity error interrupt).
+
+   Because the priority mask has at most one bit set, so does the request to
+   grant.  Its bit number is found without a scan by multiplying the isolated
+   bit by a de Bruijn sequence, which leaves a unique value in the upper five
+   bits that indexes a table of bit numbers.  This is called after every I/O
+   group instruction, so the cost matters for interrupt-heavy systems.
 */
 
+#define DEBRUIJN_32     0x077CB531u                     /* de Bruijn sequence B(2,5) */
+
+static const uint32 debruijn_bit [32] = {               /* bit numbers indexed by product */
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+    };
+
+#define LOW_BIT(v)      debruijn_bit [(uint32) (((v) & (0 - (v))) * DEBRUIJN_32) >> 27]
+
 uint32 calc_int (void)
 {
-uint32 sc, pri_mask [2], req_grant [2];
+uint32 pri_mask [2], req_grant [2];
 
 pri_mask  [0] = ~dev_prl [0] & (dev_prl [0] + 1);       /* calculate lower priority mask */
 req_grant [0] = pri_mask [0] & dev_irq [0];             /* calculate lower request to grant */
@@ -2138,18 +2153,10 @@ else {                                                  /* interrupt system off
     }
 
 if (req_grant [0])                                      /* device in lower half? */
-    for (sc = 0; sc <= 31; sc++)                        /* determine interrupting select code */
-        if (req_grant [0] & 1)                          /* grant this request? */
-            return sc;                                  /* return this select code */
-        else                                            /* not this one */
-            req_grant [0] = req_grant [0] >> 1;         /* position next request */
+    return LOW_BIT (req_grant [0]);                     /* return its select code */
 
 else if (req_grant [1])                                 /* device in upper half */
-    for (sc = 32; sc <= 63; sc++)                       /* determine interrupting select code */
-        if (req_grant [1] & 1)                          /* grant this request? */
-            return sc;                                  /* return this select code */
-        else                                            /* not this one */
-            req_grant [1] = req_grant [1] >> 1;         /* position next request */
+    return 32 + LOW_BIT (req_grant [1]);                /* return its select code */
 
 return 0;                                               /* no interrupt granted */
 }
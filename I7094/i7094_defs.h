@@ -434,6 +434,11 @@ typedef struct {
 #define DEV_7750        (1u << (DEV_V_UF + 3))
 #define DEV_7631        (1u << (DEV_V_UF + 4))
 
+/* Channel options (in unit.flags) */
+
+#define UNIT_V_CHFAST   (UNIT_V_UF + 0)
+#define UNIT_CHFAST     (1u << UNIT_V_CHFAST)           /* fast transfers */
+
 /* Unit addresses - 7607/7289 only */
 
 #define U_V_CH          9                               /* channel number */
@@ -478,6 +483,7 @@ t_stat ch6_err_disc (uint32 ch, uint32 unit, uint32 flags);
 t_stat ch6_req_rd (uint32 ch, uint32 unit, t_uint64 val, uint32 flags);
 t_stat ch6_req_wr (uint32 ch, uint32 unit);
 t_bool ch6_qconn (uint32 ch, uint32 unit);
+t_stat ch6_fast (uint32 ch, uint32 unit, t_bool *more);
 t_stat ch9_req_rd (uint32 ch, t_uint64 val);
 void ch9_set_atn (uint32 ch);
 void ch9_set_ioc (uint32 ch);
@@ -165,6 +165,8 @@ UNIT ch_unit[NUM_CHAN] = {
     };
 
 MTAB ch_mod[] = {
+    { UNIT_CHFAST, UNIT_CHFAST, "fast transfers", "FAST", NULL },
+    { UNIT_CHFAST, 0, NULL, "NOFAST", NULL },
     { MTAB_XTD|MTAB_VDV, 0, "TYPE", NULL,
       NULL, &ch_show_type, NULL },
     { MTAB_XTD|MTAB_VDV, 0, NULL, "ENABLED",
@@ -1394,6 +1396,33 @@ if (ch6_qconn (ch, unit)) {                             /* ch conn to caller? */
 return SCPE_OK;
 }
 
+/* Fast transfer - with SET CHx FAST, a device that has just requested a
+   channel cycle for a data word may have it run at once instead of waiting
+   for the CPU loop.  On return, more is TRUE if the channel is still
+   transferring for this unit in the middle of a command, so the device can
+   supply or take the next word in the same service call.  Anything that
+   needs the CPU (end of count, end of record, disconnect, traps) ends the
+   batch, and the device goes back to its normal word timing. */
+
+t_stat ch6_fast (uint32 ch, uint32 unit, t_bool *more)
+{
+t_stat r;
+
+*more = FALSE;
+if (((ch_unit[ch].flags & UNIT_CHFAST) == 0) ||         /* not fast? */
+    ((ch_req & REQ_CH (ch)) == 0))                      /* or no cycle req? */
+    return SCPE_OK;
+if ((r = ch_proc (ch)))                                 /* run channel cycle */
+    return r;
+*more = ch6_qconn (ch, unit) &&                         /* still connected, */
+    (ch_sta[ch] == CHXS_DSX) &&                         /* transferring, */
+    (ch_wc[ch] != 0) &&                                 /* count left, */
+    ((ch_flags[ch] & CHF_EOR) == 0) &&                  /* no EOR, */
+    ((ch_req & REQ_CH (ch)) == 0) &&                    /* no cycle pending, */
+    ((ch_idf[ch] & CH6DF_VLD) == 0);                    /* and word taken */
+return SCPE_OK;
+}
+
 /* Disconnect on error */
 
 t_stat ch6_err_disc (uint32 ch, uint32 unit, uint32 fl)
@@ -551,6 +551,7 @@ uint32 i, u, ch = uptr->UCH;                            /* get channel number */
 uint8 by, *xb = mtxb[ch];                               /* get xfer buffer */
 t_uint64 dat;
 t_mtrlnt bc;
+t_bool more;
 t_stat r;
 
 if (xb == NULL)                                         /* valid buffer? */
@@ -581,25 +582,28 @@ switch (uptr->UST) {                                    /* case on state */
         break;
 
     case CHSL_RDS|CHSL_2ND:                             /* read word */
-        for (i = 0, dat = 0; i < 6; i++) {              /* proc 6 bytes */
-            by = xb[mt_bptr[ch]++] & 077;               /* get next byte */
-            if ((mt_unit[ch] & 020) == 0) {             /* BCD? */
-                if (by == BCD_ZERO)                     /* cvt BCD 0 */
-                    by = 0;
-                else if (by & 020)                      /* invert zones */
-                    by = by ^ 040;
+        do {                                            /* (loop if ch fast) */
+            for (i = 0, dat = 0; i < 6; i++) {          /* proc 6 bytes */
+                by = xb[mt_bptr[ch]++] & 077;           /* get next byte */
+                if ((mt_unit[ch] & 020) == 0) {         /* BCD? */
+                    if (by == BCD_ZERO)                 /* cvt BCD 0 */
+                        by = 0;
+                    else if (by & 020)                  /* invert zones */
+                        by = by ^ 040;
+                    }
+                dat = (dat << 6) | ((t_uint64) by);
+                }
+            if (mt_bptr[ch] >= mt_blnt[ch]) {           /* end of record? */
+                ch6_req_rd (ch, mt_unit[ch], dat, CH6DF_EOR);
+                uptr->UST = CHSL_RDS|CHSL_3RD;          /* next state */
+                sim_activate (uptr, mt_tstop);          /* long timing */
+                return SCPE_OK;
                 }
-            dat = (dat << 6) | ((t_uint64) by);
-            }
-        if (mt_bptr[ch] >= mt_blnt[ch]) {               /* end of record? */
-            ch6_req_rd (ch, mt_unit[ch], dat, CH6DF_EOR);
-            uptr->UST = CHSL_RDS|CHSL_3RD;              /* next state */
-            sim_activate (uptr, mt_tstop);              /* long timing */
-            }
-        else {
             ch6_req_rd (ch, mt_unit[ch], dat, 0);       /* send to channel */
-            sim_activate (uptr, mt_tword);              /* next word */
-            }
+            if ((r = ch6_fast (ch, mt_unit[ch], &more))) /* fast? store now */
+                return r;
+            } while (more);
+        sim_activate (uptr, mt_tword);                  /* next word */
         break;
 
     case CHSL_RDS|CHSL_3RD:                             /* end record */
@@ -628,12 +632,16 @@ switch (uptr->UST) {                                    /* case on state */
         break;
 
     case CHSL_WRS|CHSL_2ND:                             /* write word */
-        if (!ch6_qconn (ch, mt_unit[ch]))               /* disconnected? */
-            return mt_rec_end (uptr);                   /* write record */
-        if (mt_chob_v[ch])                              /* valid? clear */
-            mt_chob_v[ch] = 0;
-        else ind_ioc = 1;                               /* no, io check */
-        ch6_req_wr (ch, mt_unit[ch]);                   /* request channel */
+        do {                                            /* (loop if ch fast) */
+            if (!ch6_qconn (ch, mt_unit[ch]))           /* disconnected? */
+                return mt_rec_end (uptr);               /* write record */
+            if (mt_chob_v[ch])                          /* valid? clear */
+                mt_chob_v[ch] = 0;
+            else ind_ioc = 1;                           /* no, io check */
+            ch6_req_wr (ch, mt_unit[ch]);               /* request channel */
+            if ((r = ch6_fast (ch, mt_unit[ch], &more))) /* fast? get now */
+                return r;
+            } while (more && (uptr->UST == (CHSL_WRS|CHSL_2ND)));
         sim_activate (uptr, mt_tword);                  /* next word */
         break;
 
@@ -125,6 +125,17 @@
         pdp10_defs.h    add device address and interrupt definitions
         pdp10_sys.c     add sim_devices table entry
 
+   5. Multiprocessing.  The KS10 is a single processor system, and the
+      monitors that run on it are built for one CPU; TOPS-10 SMP needs
+      KL10s (or KI10s) linked by the DTE and memory interlock hardware
+      that this simulator does not model.  The CPU state - ACs, flags,
+      PI system, APR, ebr/ubr, and the pager's expanded page tables
+      (eptbl, uptbl, ptbl_cur, ptbl_prv) - is therefore kept in globals
+      and read and written without synchronization.  Read-modify-write
+      instructions such as AOSE on a lock word are not atomic with
+      respect to anything but the simulated CPU; Unibus DMA runs on the
+      same host thread.
+
    A note on ITS 1-proceed.  The simulator follows the implementation
    on the KS10, keeping 1-proceed as a side flag (its_1pr) rather than
    as flags<8>.  This simplifies the flag saving instructions, which
@@ -2375,7 +2386,7 @@ set_dyn_ptrs ();
 set_ac_display (ac_cur);
 pi_eval ();
 if (M == NULL)
-    M = (d10 *) calloc (MAXMEMSIZE, sizeof (d10));
+    M = (d10 *) sim_mem_alloc (MAXMEMSIZE * sizeof (d10), MAXMEMSIZE * sizeof (d10));
 if (M == NULL)
     return SCPE_MEM;
 sim_vm_pc_value = &pdp10_pc_value;
@@ -769,6 +769,7 @@ int32 Map_ReadW18 (uint32 ba, int32 bc, uint32 *buf);
 int32 Map_WriteB (uint32 ba, int32 bc, uint8 *buf);
 int32 Map_WriteW (uint32 ba, int32 bc, uint16 *buf);
 int32 Map_WriteW18 (uint32 ba, int32 bc, uint32 *buf);
+int32 uba_map_run (int32 ub, int32 ba10, int32 wc, int32 fl, t_bool rev, a10 *pa);
 void uba_debug_dma_in (uint32 ba, a10 pa_start, a10 pa_end);
 void uba_debug_dma_out (uint32 ba, a10 pa_start, a10 pa_end);
 void uba_debug_dma_nxm (const char *msg, a10 pa10, uint32 ba, int32 bc);
@@ -534,6 +534,53 @@ pa10 = (ubm + PAG_GETOFF (ba >> 2)) & PAMASK;
 return pa10;
 }
 
+/* Map a run of PDP-10 words for 36-bit DMA - used by the RH11 controllers
+
+   Inputs:
+        ub      =       UBA index
+        ba10    =       Unibus address, in PDP-10 words
+        wc      =       words remaining in the transfer
+        fl      =       map flags required with valid (0 or UMAP_RRV)
+        rev     =       TRUE if the transfer runs downward
+        *pa     =       returned physical address of the first word
+   Outputs:
+        n       =       number of words, up to wc, that can be moved to
+                        or from consecutive (rev: descending) physical
+                        addresses starting at *pa; 0 if the page is not
+                        mapped for 36-bit transfers or is nonexistent
+
+   The Unibus map is consulted once per page, so a controller can move a
+   whole page of data with a block copy.  On an error, the UBA timeout
+   flag is set; the controller sets its own error bits.
+*/
+
+int32 uba_map_run (int32 ub, int32 ba10, int32 wc, int32 fl, t_bool rev, a10 *pa)
+{
+int32 vpn = PAG_GETVPN (ba10);                          /* get PDP-10 page number */
+int32 n;
+a10 pa10;
+
+if ((vpn >= UMAP_MEMSIZE) ||                            /* must be valid, 36b */
+    ((ubmap[ub][vpn] & (UMAP_VLD | UMAP_DSB | UMAP_RRV)) != (UMAP_VLD | fl))) {
+    ubcs[ub] = ubcs[ub] | UBCS_TMO;                     /* UBA times out */
+    return 0;
+    }
+pa10 = (ubmap[ub][vpn] + PAG_GETOFF (ba10)) & PAMASK;
+if (MEM_ADDR_NXM (pa10)) {                              /* nx memory? */
+    ubcs[ub] = ubcs[ub] | UBCS_TMO;
+    return 0;
+    }
+if (rev)                                                /* words left in page */
+    n = PAG_GETOFF (ba10) + 1;
+else {
+    n = PAG_SIZE - PAG_GETOFF (ba10);
+    if (n > (int32) (MEMSIZE - pa10))                   /* and in memory */
+        n = (int32) (MEMSIZE - pa10);
+    }
+*pa = pa10;
+return (n < wc)? n: wc;
+}
+
 /* Routines for Bytes, Words (16-bit) and Words (18-bit).
  *
  * Note that the byte count argument is always BYTES, even if
@@ -74,6 +74,22 @@
 
    TOPS10 vs TOPS20 is selected by a bit in the EBR; ITS paging is
    "hardwired" (it required different microcode).
+
+   Loading the UBR clears both translation tables, so a timesharing
+   system refills the user table from scratch after every context
+   switch.  For TOPS10 and TOPS20 paging, the simulator can instead
+   keep the user tables of recently run processes, tagged by UPT
+   address.  While a process runs, every page table word the fill
+   routine reads to make a user table entry is logged, with its value.
+   When the process is run again, its saved table is reinstated only if
+   every logged page table word is unchanged in memory.  Otherwise, the
+   saved table is discarded.  If TOPS20 paging keeps a CST, reinstated
+   entries are parked rather than loaded: the first read of a parked page
+   checks and updates the CST entries its fill logged, exactly as the
+   refill would, and only then loads the entry, without M, so the first
+   write still takes a full fill.  CST ages therefore change only for
+   pages the process actually touches.  SET PAG NOCTXCACHE restores the
+   hardware behavior.
 */
 
 #include "pdp10_defs.h"
@@ -88,6 +104,28 @@
 #define PTBL_V          (1u << 30)
 #define PTBL_MASK       (PAG_PPN | PTBL_M | PTBL_V)
 
+/* User page table context cache */
+
+#define PCX_NSLOT       8                               /* saved contexts */
+#define PCX_NDEP        4096                            /* max logged words */
+#define PCX_CST         (1 << 30)                       /* logged word is CST */
+#define UNIT_V_CTX      (UNIT_V_UF + 0)                 /* context cache */
+#define UNIT_CTX        (1 << UNIT_V_CTX)
+#define PCX_ON          ((pag_unit[0].flags & UNIT_CTX) && !Q_ITS)
+
+typedef struct {
+    int32               key;                            /* UPT addr, -1 = free */
+    int32               t20;                            /* TOPS20 paging */
+    d10                 spt, cst;                       /* TOPS20 bases */
+    uint32              use;                            /* LRU stamp */
+    int32               ndep;                           /* logged words */
+    a10                 dpa[PCX_NDEP];                  /* phys addresses */
+    d10                 dval[PCX_NDEP];                 /* values */
+    int32               tbl[PTBL_MEMSIZE];              /* user table */
+    int32               dbeg[PTBL_MEMSIZE];             /* log range per entry */
+    int32               dend[PTBL_MEMSIZE];
+    } PCXENT;
+
 /* NXM processing */
 
 #define REF_V           0                               /* ref is virt */
@@ -117,12 +155,29 @@ int32 uptbl[PTBL_MEMSIZE];                              /* user page table */
 int32 physptbl[PTBL_MEMSIZE];                           /* phys page table */
 int32 *ptbl_cur, *ptbl_prv;
 int32 save_ea;
+PCXENT pcx_slot[PCX_NSLOT];                             /* saved contexts */
+a10 pcx_dpa[PCX_NDEP];                                  /* live word log */
+d10 pcx_dval[PCX_NDEP];
+int32 pcx_dbeg[PTBL_MEMSIZE];                           /* log range per entry */
+int32 pcx_dend[PTBL_MEMSIZE];
+int32 pcx_park[PTBL_MEMSIZE];                           /* parked user entries */
+int32 pcx_n = 0;                                        /* live count, <0 = off */
+int32 pcx_pend = -1;                                    /* fill log, <0 = off */
+uint32 pcx_clock = 0;
+uint32 pcx_hit = 0;                                     /* statistics */
+uint32 pcx_miss = 0;
+uint32 pcx_stale = 0;
+uint32 pcx_ovf = 0;
 
 int32 ptbl_fill (a10 ea, int32 *ptbl, int32 mode);
 t_stat pag_ex (t_value *vptr, t_addr addr, UNIT *uptr, int32 sw);
 t_stat pag_dep (t_value val, t_addr addr, UNIT *uptr, int32 sw);
 t_stat pag_reset (DEVICE *dptr);
 void pag_nxm (a10 pa, int32 phys, int32 trap);
+void pag_clr (void);
+void pcx_save (void);
+void pcx_load (void);
+int32 pcx_unpark (int32 vpn);
 
 /* Pager data structures
 
@@ -132,17 +187,27 @@ void pag_nxm (a10 pa, int32 phys, int32 trap);
 */
 
 UNIT pag_unit[] = {
-    { UDATA (NULL, UNIT_FIX, PTBL_MEMSIZE) },
+    { UDATA (NULL, UNIT_FIX+UNIT_CTX, PTBL_MEMSIZE) },
     { UDATA (NULL, UNIT_FIX, PTBL_MEMSIZE) }
     };
 
 REG pag_reg[] = {
     { ORDATA (PANIC_EA, save_ea, PASIZE), REG_HRO },
+    { DRDATA (CTXHIT, pcx_hit, 32), PV_LEFT },
+    { DRDATA (CTXMISS, pcx_miss, 32), PV_LEFT },
+    { DRDATA (CTXSTALE, pcx_stale, 32), PV_LEFT },
+    { DRDATA (CTXOVF, pcx_ovf, 32), PV_LEFT },
     { NULL }
     };
 
+MTAB pag_mod[] = {
+    { UNIT_CTX, UNIT_CTX, "context cache", "CTXCACHE", NULL },
+    { UNIT_CTX, 0, "no context cache", "NOCTXCACHE", NULL },
+    { 0 }
+    };
+
 DEVICE pag_dev = {
-    "PAG", pag_unit, pag_reg, NULL,
+    "PAG", pag_unit, pag_reg, pag_mod,
     2, 8, PTBL_ASIZE, 1, 8, 32,
     &pag_ex, &pag_dep, &pag_reset,
     NULL, NULL, NULL,
@@ -313,6 +378,9 @@ return;
           of 0, and the page table entry is not filled.
         - If called from MAP, invalid references return a pte of 0. The
           page fail word is properly set up.
+        - For user table fills, the page table words read are logged
+          for the context cache.  The log is committed only when the
+          entry is stored; a page fail abandons it.
 */
 
 #define PAGE_FAIL_TRAP  if (mode & (PTF_CON | PTF_MAP)) \
@@ -322,10 +390,36 @@ return;
                             pag_nxm (y, REF_P, PF_OK); \
                             PAGE_FAIL_TRAP; \
                             } \
+                        x = ReadP (y); \
+                        PCX_LOG (y, x)
+#define READCST(x,y)    if (MEM_ADDR_NXM (y)) { \
+                            pag_nxm (y, REF_P, PF_OK); \
+                            PAGE_FAIL_TRAP; \
+                            } \
                         x = ReadP (y)
+#define PCX_LOG(y,x)    if (pcx_pend >= 0) { \
+                            if (pcx_pend < PCX_NDEP) { \
+                                pcx_dpa[pcx_pend] = (y); \
+                                pcx_dval[pcx_pend] = (x); \
+                                } \
+                            pcx_pend++; \
+                            }
+#define PCX_STORE(v,x)  tbl[v] = x; \
+                        if (pcx_pend >= 0) { \
+                            if (pcx_pend > PCX_NDEP) { \
+                                pcx_ovf++; \
+                                pcx_n = -1; \
+                                } \
+                            else { \
+                                pcx_dbeg[v] = pcx_n; \
+                                pcx_dend[v] = pcx_n = pcx_pend; \
+                                } \
+                            }
 
 int32 ptbl_fill (a10 ea, int32 *tbl, int32 mode)
 {
+pcx_pend = ((tbl == uptbl) && (pcx_n >= 0) && !(mode & PTF_CON))?
+    pcx_n: -1;                                          /* log user fills */
 
 /* ITS paging is based on conventional page tables.  ITS divides each address
    space into a 128K high and low section, and uses different descriptor base
@@ -400,8 +494,9 @@ else if (!T20PAG) {                                     /* TOPS-10 paging */
     if ((pte & PTE_T10_A) && (!(mode & PTF_WR) || (pte & PTE_T10_W))) {
         xpte = ((pte & PTE_PPMASK) << PAG_V_PN) |       /* calc exp pte */
             PTBL_V | ((pte & PTE_T10_W)? PTBL_M: 0);
-        if (!(mode & PTF_CON))                          /* set tbl if ~cons */
-            tbl[vpn] = xpte;
+        if (!(mode & PTF_CON)) {                        /* set tbl if ~cons */
+            PCX_STORE (vpn, xpte);
+            }
         return xpte;
         }
     PAGE_FAIL_TRAP;
@@ -453,6 +548,10 @@ else {                                                  /* TOPS-20 paging */
 */
 
     vpn = PAG_GETVPN (ea);                              /* get virt page num */
+    if ((tbl == uptbl) && pcx_park[vpn] &&              /* parked entry? */
+        !(mode & (PTF_CON | PTF_MAP | PTF_WR)) &&       /* plain read? */
+        ((xpte = pcx_unpark (vpn)) != 0))
+        return xpte;
     pa = (tbl == uptbl)? upta + UPT_T20_SCTN: epta + EPT_T20_SCTN;
     READPT (ptr, pa & PAMASK);                          /* get section 0 ptr */
     for (stop = FALSE, flg = 0; !stop; flg++) {         /* eval section ptrs */
@@ -501,12 +600,13 @@ else {                                                  /* TOPS-20 paging */
             }
         if (cst) {                                      /* cst really there? */
             csta = (int32) ((cst + (ptr & PTE_PPMASK)) & PAMASK);
-            READPT (cste, csta);                        /* get CST entry */
+            READCST (cste, csta);                       /* get CST entry */
             if ((cste & CST_AGE) == 0) {
                 PAGE_FAIL_TRAP;
                 }
             cste = (cste & cstm) | pur;                 /* update entry */
             WriteP (csta, cste);                        /* rewrite */
+            PCX_LOG (csta | PCX_CST, cste);
             }
         READPT (ptr, pa & PAMASK);                      /* get pointer */
         acc = acc & ptr;                                /* cascade acc bits */
@@ -544,7 +644,7 @@ else {                                                  /* TOPS-20 paging */
         }
     if (cst) {                                          /* CST really there? */
         csta = (int32) ((cst + (ptr & PTE_PPMASK)) & PAMASK);
-        READPT (cste, csta);                            /* get CST entry */
+        READCST (cste, csta);                           /* get CST entry */
         if ((cste & CST_AGE) == 0) {
             PAGE_FAIL_TRAP;
             }
@@ -562,14 +662,17 @@ else {                                                  /* TOPS-20 paging */
             PAGE_FAIL_TRAP;
             }
         }
-    if (cst)                                            /* write CST entry */
+    if (cst) {                                          /* write CST entry */
         WriteP (csta, cste);
+        PCX_LOG (csta | PCX_CST, cste);
+        }
     if (mode & PTF_MAP) pager_word = pager_word |       /* map? more in pf wd */
         ((xpte & PTBL_M)? PF_T20_M: 0) |                /* M, W, C bits */
         ((acc & PTE_T20_W)? PF_T20_W: 0) |
         ((acc & PTE_T20_C)? PF_C: 0);
-    if (!(mode & PTF_CON))                              /* set tbl if ~cons */
-        tbl[vpn] = xpte;
+    if (!(mode & PTF_CON)) {                            /* set tbl if ~cons */
+        PCX_STORE (vpn, xpte);
+        }
     return xpte;
     }                                                   /* end TOPS20 paging */
 }
@@ -665,6 +768,7 @@ if (Q_ITS) {                                            /* ITS? */
 else {
     uptbl[vpn] = 0;                                     /* clear entries in */
     eptbl[vpn] = 0;                                     /* both page tables */
+    pcx_park[vpn] = 0;
     }
 return FALSE;
 } 
@@ -692,15 +796,128 @@ if (val & UBR_SETACB)                                   /* set AC's? */
     ubr = ubr & ~UBR_ACBMASK;
 else val = val & ~UBR_ACBMASK;                          /* no, keep old val */
 if (val & UBR_SETUBR) {                                 /* set UBR? */
+    if (PCX_ON)                                         /* ctx cache? save */
+        pcx_save ();
     ubr = ubr & ~ubr_mask;
-    pag_reset (&pag_dev);                               /* yes, clr pg tbls */
+    pag_clr ();                                         /* yes, clr pg tbls */
     }
 else val = val & ~ubr_mask;                             /* no, keep old val */
 ubr = (ubr | val) & (UBR_ACBMASK | ubr_mask);
 set_dyn_ptrs ();
+if ((val & UBR_SETUBR) && PCX_ON)                       /* ctx cache? restore */
+    pcx_load ();
 return FALSE;
 }
 
+/* User page table context cache
+
+   pcx_save - save the live user table and its word log, keyed by UPT
+   pcx_load - reinstate the saved table for the new UPT, if still valid
+   pcx_unpark - load a parked entry on its first read, updating the CST
+*/
+
+void pcx_save (void)
+{
+int32 i, k;
+PCXENT *cx;
+
+if ((pcx_n <= 0) || !PAGING)                            /* nothing to save? */
+    return;
+for (i = k = 0; i < PCX_NSLOT; i++) {                   /* find slot */
+    if (pcx_slot[i].key == upta)
+        break;
+    if ((pcx_slot[i].key < 0) ||                        /* else free or LRU */
+        ((pcx_slot[k].key >= 0) && (pcx_slot[i].use < pcx_slot[k].use)))
+        k = i;
+    }
+cx = &pcx_slot[(i < PCX_NSLOT)? i: k];
+cx->key = upta;
+cx->t20 = T20PAG? 1: 0;
+cx->spt = spt;
+cx->cst = cst;
+cx->use = ++pcx_clock;
+cx->ndep = pcx_n;
+memcpy (cx->dpa, pcx_dpa, pcx_n * sizeof (a10));
+memcpy (cx->dval, pcx_dval, pcx_n * sizeof (d10));
+for (i = 0; i < PTBL_MEMSIZE; i++)                      /* parked entries */
+    cx->tbl[i] = uptbl[i]? uptbl[i]: pcx_park[i];       /* are still valid */
+memcpy (cx->dbeg, pcx_dbeg, sizeof (pcx_dbeg));
+memcpy (cx->dend, pcx_dend, sizeof (pcx_dend));
+return;
+}
+
+void pcx_load (void)
+{
+int32 i, pa;
+PCXENT *cx;
+
+if (!PAGING)
+    return;
+for (i = 0; i < PCX_NSLOT; i++) {                       /* find slot */
+    if (pcx_slot[i].key == upta)
+        break;
+    }
+if (i >= PCX_NSLOT) {                                   /* not there? */
+    pcx_miss++;
+    return;
+    }
+cx = &pcx_slot[i];
+cx->key = -1;                                           /* slot now free */
+if ((cx->t20 != (T20PAG? 1: 0)) || (cx->spt != spt) || (cx->cst != cst)) {
+    pcx_stale++;
+    return;
+    }
+for (i = 0; i < cx->ndep; i++) {                        /* validate log */
+    if (cx->dpa[i] & PCX_CST)                           /* CST: at first use */
+        continue;
+    pa = cx->dpa[i];
+    if (MEM_ADDR_NXM (pa) || (M[pa] != cx->dval[i]))    /* ptr: unchanged */
+        break;
+    }
+if (i < cx->ndep) {                                     /* changed? discard */
+    pcx_stale++;
+    return;
+    }
+pcx_n = cx->ndep;                                       /* now live */
+memcpy (pcx_dpa, cx->dpa, pcx_n * sizeof (a10));
+memcpy (pcx_dval, cx->dval, pcx_n * sizeof (d10));
+memcpy (pcx_dbeg, cx->dbeg, sizeof (pcx_dbeg));
+memcpy (pcx_dend, cx->dend, sizeof (pcx_dend));
+if (T20PAG && cst)                                      /* CST to update? */
+    memcpy (pcx_park, cx->tbl, sizeof (pcx_park));      /* park entries */
+else memcpy (uptbl, cx->tbl, sizeof (uptbl));
+pcx_hit++;
+return;
+}
+
+/* Parked entries are loaded by the first read of their page.  Each CST entry
+   logged by the entry's fill must still have a non-zero age, and is updated
+   as the fill would update it.  A write, or an entry that fails the age
+   test, gets a full fill instead, which takes any page fail.
+*/
+
+int32 pcx_unpark (int32 vpn)
+{
+int32 i, pa;
+int32 xpte = pcx_park[vpn] & ~PTBL_M;                   /* M on first write */
+
+pcx_park[vpn] = 0;                                      /* one use only */
+for (i = pcx_dbeg[vpn]; i < pcx_dend[vpn]; i++) {       /* age test first */
+    pa = pcx_dpa[i] & ~PCX_CST;
+    if ((pcx_dpa[i] & PCX_CST) &&
+        (MEM_ADDR_NXM (pa) || ((M[pa] & CST_AGE) == 0)))
+        return 0;
+    }
+for (i = pcx_dbeg[vpn]; i < pcx_dend[vpn]; i++) {       /* update CST */
+    if (pcx_dpa[i] & PCX_CST) {
+        pa = pcx_dpa[i] & ~PCX_CST;
+        M[pa] = (M[pa] & cstm) | pur;
+        }
+    }
+uptbl[vpn] = xpte;
+return xpte;
+}
+
 t_bool rdubr (a10 ea, int32 prv)
 {
 ubr = ubr & (UBR_ACBMASK | (Q_ITS? PAMASK: UBR_UBRMASK));
@@ -885,8 +1102,11 @@ int32 tbln = uptr - pag_unit;
 
 if (addr >= PTBL_MEMSIZE)
     return SCPE_NXM;
-if (tbln)
+if (tbln) {
     uptbl[addr] = (int32) val & PTBL_MASK;
+    pcx_park[addr] = 0;
+    pcx_n = -1;                                         /* not from fills */
+    }
 else eptbl[addr] = (int32) val & PTBL_MASK;
 return SCPE_OK;
 }
@@ -895,9 +1115,22 @@ t_stat pag_reset (DEVICE *dptr)
 {
 int32 i;
 
+for (i = 0; i < PCX_NSLOT; i++)                         /* flush contexts */
+    pcx_slot[i].key = -1;
+pag_clr ();
+return SCPE_OK;
+}
+
+/* Clear translation tables */
+
+void pag_clr (void)
+{
+int32 i;
+
 for (i = 0; i < PTBL_MEMSIZE; i++) {
-    eptbl[i] = uptbl[i] = 0;
+    eptbl[i] = uptbl[i] = pcx_park[i] = 0;
     physptbl[i] = (i << PAG_V_PN) + PTBL_M + PTBL_V;
     }
-return SCPE_OK;
+pcx_n = PCX_ON? 0: -1;                                  /* empty word log */
+return;
 }
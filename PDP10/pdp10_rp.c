@@ -375,6 +375,7 @@ t_stat rp_detach (UNIT *uptr);
 void set_rper (int16 flag, int32 drv);
 void update_rpcs (int32 flags, int32 drv);
 void rp_go (int32 drv, int32 fnc);
+int32 rp_map (int32 ba, int32 wc, a10 *pa);
 t_stat rp_set_size (UNIT *uptr, int32 val, char *cptr, void *desc);
 
 /* RP data structures
@@ -878,9 +879,9 @@ return;
 
 t_stat rp_svc (UNIT *uptr)
 {
-int32 i, dtype, drv, err;
-int32 ba, da, vpn;
-a10 pa10, mpa10;
+int32 i, n, dtype, drv, err;
+int32 ba, da;
+a10 mpa10;
 int32 wc10, twc10, awc10, fc10;
 static d10 dbuf[RP_MAXFR];
 
@@ -950,24 +951,12 @@ switch (uptr->FUNC) {                                   /* case on function */
 
         err = fseek (uptr->fileref, da * sizeof (d10), SEEK_SET);
         if (uptr->FUNC == FNC_WRITE) {                  /* write? */
-            for (twc10 = 0; twc10 < wc10; twc10++) {
-                pa10 = ba >> 2;
-                vpn = PAG_GETVPN (pa10);                /* map addr */
-                if ((vpn >= UMAP_MEMSIZE) || (ba & XBA_MBZ) || (rpwc & XWC_MBZ) ||
-                  ((ubmap[0][vpn] & (UMAP_VLD | UMAP_DSB | UMAP_RRV)) != UMAP_VLD)) {
-                    rpcs2 = rpcs2 | CS2_NEM;            /* set error */
-                    ubcs[0] = ubcs[0] | UBCS_TMO;       /* UBA times out */
-                    break;
-                    }
-                mpa10 = (ubmap[0][vpn] + PAG_GETOFF (pa10)) & PAMASK;
-                if (MEM_ADDR_NXM (mpa10)) {             /* nx memory? */
-                    rpcs2 = rpcs2 | CS2_NEM;            /* set error */
-                    ubcs[0] = ubcs[0] | UBCS_TMO;       /* UBA times out */
-                    break;
-                    }
-                dbuf[twc10] = M[mpa10];                 /* write to disk */
+            for (twc10 = 0; twc10 < wc10; twc10 = twc10 + n) {
+                if ((n = rp_map (ba, wc10 - twc10, &mpa10)) == 0)
+                    break;                              /* map run, err? */
+                memcpy (&dbuf[twc10], &M[mpa10], n * sizeof (d10));
                 if ((rpcs2 & CS2_UAI) == 0)
-                    ba = ba + 4;
+                    ba = ba + (n << 2);
                 }
             if ((fc10 = twc10 & (RP_NUMWD - 1))) {      /* fill? */
                 fc10 = RP_NUMWD - fc10;
@@ -982,30 +971,24 @@ switch (uptr->FUNC) {                                   /* case on function */
             err = ferror (uptr->fileref);
             for ( ; awc10 < wc10; awc10++)
                 dbuf[awc10] = 0;
-            for (twc10 = 0; twc10 < wc10; twc10++) {
-                pa10 = ba >> 2;
-                vpn = PAG_GETVPN (pa10);                /* map addr */
-                if ((vpn >= UMAP_MEMSIZE) || (ba & XBA_MBZ) || (rpwc & XWC_MBZ) ||
-                  ((ubmap[0][vpn] & (UMAP_VLD | UMAP_DSB | UMAP_RRV)) != UMAP_VLD)) {
-                    rpcs2 = rpcs2 | CS2_NEM;            /* set error */
-                    ubcs[0] = ubcs[0] | UBCS_TMO;       /* UBA times out */
-                    break;
-                    }
-                mpa10 = (ubmap[0][vpn] + PAG_GETOFF (pa10)) & PAMASK;
-                if (MEM_ADDR_NXM (mpa10)) {             /* nx memory? */
-                    rpcs2 = rpcs2 | CS2_NEM;            /* set error */
-                    ubcs[0] = ubcs[0] | UBCS_TMO;       /* UBA times out */
-                    break;
-                    }
+            for (twc10 = 0; twc10 < wc10; twc10 = twc10 + n) {
+                if ((n = rp_map (ba, wc10 - twc10, &mpa10)) == 0)
+                    break;                              /* map run, err? */
                 if ((uptr->FUNC == FNC_READ) ||         /* read or */
                     (uptr->FUNC == FNC_READH))          /* read header */
-                     M[mpa10] = dbuf[twc10];
-                else if (M[mpa10] != dbuf[twc10]) {     /* wchk, mismatch? */
-                     rpcs2 = rpcs2 | CS2_WCE;           /* set error */
-                     break;
-                     }
+                     memcpy (&M[mpa10], &dbuf[twc10], n * sizeof (d10));
+                else {                                  /* wchk */
+                    for (i = 0; (i < n) && (M[mpa10 + i] == dbuf[twc10 + i]); i++) ;
+                    if (i < n) {                        /* mismatch? */
+                        rpcs2 = rpcs2 | CS2_WCE;        /* set error */
+                        twc10 = twc10 + i;
+                        if ((rpcs2 & CS2_UAI) == 0)
+                            ba = ba + (i << 2);
+                        break;
+                        }
+                    }
                 if ((rpcs2 & CS2_UAI) == 0)
-                    ba = ba + 4;
+                    ba = ba + (n << 2);
                 }
             }                                           /* end else */
 
@@ -1037,6 +1020,25 @@ switch (uptr->FUNC) {                                   /* case on function */
 return SCPE_OK;
 }
 
+/* Map a run of words for a data transfer
+
+   Returns the number of words that can be moved with the bus address
+   incrementing, or 1 if the address is held (CS2_UAI); 0 on an error.
+*/
+
+int32 rp_map (int32 ba, int32 wc, a10 *pa)
+{
+int32 n;
+
+if ((ba & XBA_MBZ) || (rpwc & XWC_MBZ) ||               /* bad xfer or map? */
+    ((n = uba_map_run (0, ba >> 2, wc, 0, FALSE, pa)) == 0)) {
+    rpcs2 = rpcs2 | CS2_NEM;                            /* set error */
+    ubcs[0] = ubcs[0] | UBCS_TMO;                       /* UBA times out */
+    return 0;
+    }
+return (rpcs2 & CS2_UAI)? 1: n;
+}
+
 /* Set drive error */
 
 void set_rper (int16 flag, int32 drv)
@@ -281,18 +281,8 @@
                             return SCPE_OK; \
                             }
 #define NEWPAGE(v,m)    (((v) & PAG_M_OFF) == (m))
-#define MAPM(v,p,f)     vpn = PAG_GETVPN (v); \
-                        if ((vpn >= UMAP_MEMSIZE) || ((ubmap[1][vpn] & \
-                            (UMAP_VLD | UMAP_DSB | UMAP_RRV)) != \
-                            (UMAP_VLD | f))) { \
+#define MAPM(v,p,f)     if (uba_map_run (1, v, 1, f, (f) != 0, &p) == 0) { \
                             tucs2 = tucs2 | CS2_NEM; \
-                            ubcs[1] = ubcs[1] | UBCS_TMO; \
-                            break; \
-                            } \
-                        p = (ubmap[1][vpn] + PAG_GETOFF (v)) & PAMASK; \
-                        if (MEM_ADDR_NXM (p)) { \
-                            tucs2 = tucs2 | CS2_NEM; \
-                            ubcs[1] = ubcs[1] | UBCS_TMO; \
                             break; \
                             }
 
@@ -810,7 +800,7 @@ return;
 t_stat tu_svc (UNIT *uptr)
 {
 int32 fnc, fmt, i, j, k, wc10, ba10;
-int32 ba, fc, wc, drv, mpa10 = 0, vpn;
+int32 ba, fc, wc, drv, mpa10 = 0;
 d10 val, v[4];
 t_mtrlnt tbc;
 t_stat st, r = SCPE_OK;
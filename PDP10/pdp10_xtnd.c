@@ -153,6 +153,9 @@ d10 incloadbp (int32 ac, int32 pflgs);
 void incstorebp (d10 val, int32 ac, int32 pflgs);
 d10 xlate (d10 by, a10 tblad, d10 *xflgs, int32 pflgs);
 void filldst (d10 fill, int32 ac, d10 cnt, int32 pflgs);
+static int32 xt_wdbp (d10 bp, a10 *ba);
+static t_bool xt_wdcmp (int32 ac, int32 pflgs);
+static t_bool xt_wdmov (int32 ac, d10 fill, int32 pflgs);
 
 static const d10 pwrs10[23][2] = {
 {           INT64_C(0),           INT64_C(0),},
@@ -224,6 +227,8 @@ switch (xop) {                                          /* case on opcode */
             if (flg && (t = test_int ()))
                 ABORT (t);
             rlog = 0;                                   /* clear log */
+            if (xt_wdcmp (ac, pflgs))                   /* word equal? */
+                continue;
             if (AC(ac))                                 /* src1 */
                 b1 = incloadbp (p1, pflgs);
             else b1 = f1;
@@ -434,6 +439,9 @@ switch (xop) {                                          /* case on opcode */
             if (flg && (t = test_int ()))
                 ABORT (t);
             rlog = 0;                                   /* clear log */
+            if (((xop == XT_MOVSLJ) || (xop == XT_MOVSRJ)) &&
+                xt_wdmov (ac, f1, pflgs))               /* word moved? */
+                continue;
             if (AC(ac) & XLNTMASK) {                    /* any source? */
                 b1 = incloadbp (p1, pflgs);             /* src byte */
                 if (xop == XT_MOVSO) {                  /* offset? */
@@ -732,6 +740,94 @@ rlog = 0;
 return;
 }
 
+/* Word-parallel string support
+
+   When the next byte of a string starts a word, and the string has
+   at least a word of bytes left, a whole word of bytes can be moved or
+   compared at once.  Both pointers must be direct and unindexed, with
+   the same byte size.  Nothing is changed until the last reference has
+   been made; a page fail leaves the ACs as they were, and the register
+   log is empty.
+
+   xt_wdbp      test byte pointer, return bytes per word and word address
+   xt_wdcmp     compare a word of bytes, CMPSx; TRUE if equal and done
+   xt_wdmov     move or fill a word of bytes, MOVSLJ/MOVSRJ; TRUE if done
+*/
+
+static int32 xt_wdbp (d10 bp, a10 *ba)
+{
+int32 p = GET_P (bp);
+int32 s = GET_S (bp);
+
+if ((s == 0) || (s > 18) || GET_XR (bp) || TST_IND (bp))
+    return 0;
+if (p < s)                                              /* next word? */
+    *ba = INCR (bp);
+else if (p == 36)                                       /* start of word? */
+    *ba = GET_ADDR (bp);
+else return 0;
+return 36 / s;
+}
+
+static t_bool xt_wdcmp (int32 ac, int32 pflgs)
+{
+int32 p1 = ADDAC (ac, 1);
+int32 p3 = ADDAC (ac, 3);
+int32 p4 = ADDAC (ac, 4);
+int32 k, r;
+a10 ba1, ba2;
+d10 msk;
+
+k = xt_wdbp (AC(p1), &ba1);                             /* src1 word bytes */
+if ((k == 0) || (AC(ac) < k) || (AC(p3) < k) ||
+    (GET_S (AC(p4)) != GET_S (AC(p1))) || (xt_wdbp (AC(p4), &ba2) != k))
+    return FALSE;
+r = 36 - (k * GET_S (AC(p1)));                          /* unused low bits */
+msk = DMASK & ~bytemask[r];
+if ((Read (ba1, MM_XSRC) ^ Read (ba2, MM_XSRC)) & msk)  /* differ? */
+    return FALSE;                                       /* find byte */
+AC(p1) = PUT_P ((AC(p1) & LMASK) | ba1, r);             /* advance both */
+AC(p4) = PUT_P ((AC(p4) & LMASK) | ba2, r);
+AC(ac) = AC(ac) - k;
+AC(p3) = AC(p3) - k;
+return TRUE;
+}
+
+static t_bool xt_wdmov (int32 ac, d10 fill, int32 pflgs)
+{
+int32 p1 = ADDAC (ac, 1);
+int32 p3 = ADDAC (ac, 3);
+int32 p4 = ADDAC (ac, 4);
+int32 i, k, r, s;
+a10 sa = 0, da;
+d10 wd, msk;
+
+k = xt_wdbp (AC(p4), &da);                              /* dst word bytes */
+if ((k == 0) || (AC(p3) < k))
+    return FALSE;
+s = GET_S (AC(p4));
+r = 36 - (k * s);                                       /* unused low bits */
+msk = DMASK & ~bytemask[r];
+if (AC(ac)) {                                           /* source? */
+    if ((AC(ac) < k) || (GET_S (AC(p1)) != s) || (xt_wdbp (AC(p1), &sa) != k))
+        return FALSE;
+    wd = Read (sa, MM_XSRC);                            /* word of bytes */
+    }
+else {                                                  /* fill */
+    for (i = 0, wd = 0; i < k; i++)
+        wd = (wd << s) | (fill & bytemask[s]);
+    wd = wd << r;
+    }
+Write (da, (Read (da, MM_XDST) & ~msk) | (wd & msk), MM_XDST);
+if (AC(ac)) {                                           /* advance src */
+    AC(p1) = PUT_P ((AC(p1) & LMASK) | sa, r);
+    AC(ac) = AC(ac) - k;
+    }
+AC(p4) = PUT_P ((AC(p4) & LMASK) | da, r);              /* advance dst */
+AC(p3) = AC(p3) - k;
+return TRUE;
+}
+
 /* Clean up after page fault
 
    Arguments:
@@ -210,7 +210,9 @@
       under the interrupt priority level, ipl.  If any interrupt request
       is not masked, the interrupt bit is set in trap_req.  While most
       interrupts are handled centrally, a device can supply an interrupt
-      acknowledge routine.
+      acknowledge routine.  Variable int_summ has a bit set for each level
+      of int_req with a request pending, so that the interrupt evaluation
+      need not scan the levels.
 
    3. PSW handling.  The PSW is kept as components, for easier access.
       Because the PSW can be explicitly written as address 17777776,
@@ -256,6 +258,17 @@ typedef struct {
     uint16              inst[HIST_ILNT];
     } InstHistory;
 
+#define TLB_V           1                               /* entry filled */
+#define TLB_RD          2                               /* read ok */
+#define TLB_WR          4                               /* write ok */
+
+typedef struct {
+    int32               acc;                            /* access, 0 = empty */
+    int32               lo;                             /* first valid offset */
+    int32               hi;                             /* last valid offset */
+    int32               base;                           /* page phys base */
+    } TLBENT;
+
 /* Global state */
 
 uint16 *M = NULL;                                       /* memory */
@@ -274,6 +287,7 @@ int32 PSW = 0;                                          /* PSW */
 int32 wait_state = 0;                                   /* wait state */
 int32 trap_req = 0;                                     /* trap requests */
 int32 int_req[IPL_HLVL] = { 0 };                        /* interrupt requests */
+int32 int_summ = 0;                                     /* levels with int_req */
 int32 PIRQ = 0;                                         /* programmed int req */
 int32 STKLIM = 0;                                       /* stack limit */
 fpac_t FR[6] = { {0} };                                 /* fp accumulators */
@@ -305,6 +319,8 @@ int32 hst_lnt = 0;                                      /* history length */
 InstHistory *hst = NULL;                                /* instruction history */
 int32 dsmask[4] = { MMR3_KDS, MMR3_SDS, 0, MMR3_UDS };  /* dspace enables */
 t_addr cpu_memsize = INIMEMSIZE;                        /* last mem addr */
+static TLBENT cpu_tlb[64];                              /* reloc TLB */
+static int32 cpu_fastlim = 0160000;                     /* unmapped fast limit */
 
 extern int32 CPUERR, MAINT;
 extern CPUTAB cpu_tab[];
@@ -341,6 +357,8 @@ void set_stack_trap (int32 adr);
 int32 get_PSW (void);
 void put_PSW (int32 val, t_bool prot);
 void put_PIRQ (int32 val);
+static void tlb_fill (int32 apridx);
+static void tlb_flush (void);
 
 extern void fp11 (int32 IR);
 extern t_stat cis11 (int32 IR);
@@ -612,6 +630,8 @@ MTAB cpu_mod[] = {
     { MTAB_XTD|MTAB_VDV, OPT_BVT, NULL, "NOBEVENT", &cpu_clr_opt, NULL, NULL, "Disable BEVENT line (11/03, 11/23 only)" },
     { MTAB_XTD|MTAB_VDV, 0, "IDLE", "IDLE", &sim_set_idle, &sim_show_idle },
     { MTAB_XTD|MTAB_VDV, 0, NULL, "NOIDLE", &sim_clr_idle, NULL },
+    { UNIT_NOFAST, 0, NULL, "FAST", NULL, NULL, NULL, "Use inline memory fast paths" },
+    { UNIT_NOFAST, UNIT_NOFAST, "NOFAST", "NOFAST", NULL, NULL, NULL, "Use only the reference memory routines" },
     { UNIT_MSIZE, 16384, NULL, "16K", &cpu_set_size},
     { UNIT_MSIZE, 32768, NULL, "32K", &cpu_set_size},
     { UNIT_MSIZE, 49152, NULL, "48K", &cpu_set_size},
@@ -654,6 +674,200 @@ DEVICE cpu_dev = {
     NULL, &cpu_set_size, NULL
     };
 
+/* Inline memory access fast paths
+
+   The instruction loop, GeteaW and GeteaB call these in place of the
+   out of line memory routines.  The fast path handles the common case:
+   an aligned reference to main memory, with memory management either
+   off or mapping through a resident page that permits the access and
+   passes the page length check.  Anything else (odd address, I/O page,
+   nonexistent memory, abort, trap) falls through to the full routine,
+   which repeats the relocation and takes the slow path.
+
+   Define PDP11_NO_FAST_MEM to compile the loop against the out of
+   line routines only; SET CPU NOFAST sends every reference down the
+   full path at run time, for comparison against the fast paths.
+*/
+
+/* Software TLB fill and flush */
+
+static void tlb_fill (int32 apridx)
+{
+TLBENT *tp = &cpu_tlb[apridx];
+int32 apr = APRFILE[apridx];
+int32 plf = (apr & PDR_PLF) >> 2;                       /* extr page length */
+int32 top;
+
+tp->acc = TLB_V;
+if (cpu_unit.flags & UNIT_NOFAST)                       /* fast paths off? */
+    return;
+if ((apr & PDR_PRD) == 2)                               /* readable? */
+    tp->acc = tp->acc | TLB_RD;
+if ((apr & PDR_ACF) == 6)                               /* writeable? */
+    tp->acc = tp->acc | TLB_WR;
+if (apr & PDR_ED) {                                     /* expand down? */
+    tp->lo = plf;
+    tp->hi = VA_DF;
+    }
+else {                                                  /* expand up */
+    tp->lo = 0;
+    tp->hi = plf | 077;
+    }
+tp->base = (apr >> 10) & 017777700;                     /* page base */
+if (MMR3 & MMR3_M22E)                                   /* 22b mapping? */
+    top = (int32) cpu_memsize;
+else {                                                  /* 18b, no I/O page */
+    tp->base = tp->base & 0777777;
+    top = ((int32) cpu_memsize < 0760000)? (int32) cpu_memsize: 0760000;
+    }
+if ((tp->base + tp->hi) >= top)                         /* clip to memory */
+    tp->hi = top - 1 - tp->base;
+return;
+}
+
+static void tlb_flush (void)
+{
+memset (cpu_tlb, 0, sizeof (cpu_tlb));
+return;
+}
+
+#if defined (PDP11_NO_FAST_MEM)
+
+#define ReadE_fast(va)          ReadE (va)
+#define ReadW_fast(va)          ReadW (va)
+#define ReadB_fast(va)          ReadB (va)
+#define ReadMW_fast(va)         ReadMW (va)
+#define ReadMB_fast(va)         ReadMB (va)
+#define WriteW_fast(d,va)       WriteW (d, va)
+#define WriteB_fast(d,va)       WriteB (d, va)
+#define PWriteW_fast(d,pa)      PWriteW (d, pa)
+#define PWriteB_fast(d,pa)      PWriteB (d, pa)
+
+#else
+
+/* Fast relocation - returns memory pa, or -1 if the full path is needed
+
+   With memory management on, the page is looked up in a software TLB
+   indexed like APRFILE (mode, I/D space, page).  An entry caches the
+   physical base of the page, the access it allows without a trap, and
+   the range of page offsets that pass the page length check and land
+   in main memory.  Entries are filled on first use and flushed when a
+   PAR/PDR, MMR0 or MMR3 is written, and on entry to the simulator.
+*/
+
+static SIM_INLINE int32 reloc_fast (int32 va, int32 acc)
+{
+int32 apridx, off;
+TLBENT *tp;
+
+if (MMR0 & MMR0_MME) {                                  /* if mmgt */
+    apridx = (va >> VA_V_APF) & 077;                    /* index into TLB */
+    tp = &cpu_tlb[apridx];
+    if (tp->acc == 0)                                   /* empty? fill */
+        tlb_fill (apridx);
+    off = va & VA_DF;
+    if (((tp->acc & acc) == 0) ||                       /* no access or */
+        (off < tp->lo) || (off > tp->hi))               /* out of range? */
+        return -1;
+    if (acc == TLB_WR)                                  /* set W */
+        APRFILE[apridx] = APRFILE[apridx] | PDR_W;
+    return tp->base + off;
+    }
+off = va & 0177777;                                     /* mmgt off */
+if ((off >= cpu_fastlim) || !ADDR_IS_MEM (off))         /* I/O page, NXM? */
+    return -1;
+return off;
+}
+
+static SIM_INLINE int32 ReadE_fast (int32 va)
+{
+int32 pa;
+
+if (((va & 1) == 0) && ((pa = reloc_fast (va, TLB_RD)) >= 0))
+    return M[pa >> 1];
+return ReadE (va);
+}
+
+static SIM_INLINE int32 ReadW_fast (int32 va)
+{
+int32 pa;
+
+if (((va & 1) == 0) && ((pa = reloc_fast (va, TLB_RD)) >= 0))
+    return M[pa >> 1];
+return ReadW (va);
+}
+
+static SIM_INLINE int32 ReadB_fast (int32 va)
+{
+int32 pa;
+
+if ((pa = reloc_fast (va, TLB_RD)) >= 0)
+    return (va & 1? M[pa >> 1] >> 8: M[pa >> 1]) & 0377;
+return ReadB (va);
+}
+
+static SIM_INLINE int32 ReadMW_fast (int32 va)
+{
+int32 pa;
+
+if (((va & 1) == 0) && ((pa = reloc_fast (va, TLB_WR)) >= 0)) {
+    last_pa = pa;
+    return M[pa >> 1];
+    }
+return ReadMW (va);
+}
+
+static SIM_INLINE int32 ReadMB_fast (int32 va)
+{
+int32 pa;
+
+if ((pa = reloc_fast (va, TLB_WR)) >= 0) {
+    last_pa = pa;
+    return (va & 1? M[pa >> 1] >> 8: M[pa >> 1]) & 0377;
+    }
+return ReadMB (va);
+}
+
+static SIM_INLINE void WriteW_fast (int32 data, int32 va)
+{
+int32 pa;
+
+if (((va & 1) == 0) && ((pa = reloc_fast (va, TLB_WR)) >= 0))
+    M[pa >> 1] = data;
+else WriteW (data, va);
+}
+
+static SIM_INLINE void WriteB_fast (int32 data, int32 va)
+{
+int32 pa;
+
+if ((pa = reloc_fast (va, TLB_WR)) >= 0) {
+    if (va & 1)
+        M[pa >> 1] = (M[pa >> 1] & 0377) | (data << 8);
+    else M[pa >> 1] = (M[pa >> 1] & ~0377) | data;
+    }
+else WriteB (data, va);
+}
+
+static SIM_INLINE void PWriteW_fast (int32 data, int32 pa)
+{
+if (ADDR_IS_MEM (pa))
+    M[pa >> 1] = data;
+else PWriteW (data, pa);
+}
+
+static SIM_INLINE void PWriteB_fast (int32 data, int32 pa)
+{
+if (ADDR_IS_MEM (pa)) {
+    if (pa & 1)
+        M[pa >> 1] = (M[pa >> 1] & 0377) | (data << 8);
+    else M[pa >> 1] = (M[pa >> 1] & ~0377) | data;
+    }
+else PWriteB (data, pa);
+}
+
+#endif
+
 t_value pdp11_pc_value (void)
 {
 return (t_value)PC;
@@ -683,6 +897,8 @@ if (MEMSIZE < cpu_tab[cpu_model].maxm)                  /* mem size < max? */
     cpu_memsize = MEMSIZE;                              /* then okay */
 else cpu_memsize = cpu_tab[cpu_model].maxm - IOPAGESIZE;/* max - io page */
 cpu_type = 1u << cpu_model;                             /* reset type mask */
+cpu_fastlim = (cpu_unit.flags & UNIT_NOFAST)? 0: 0160000;
+tlb_flush ();                                           /* mapping may differ */
 cpu_bme = (MMR3 & MMR3_BME) && (cpu_opt & OPT_UBM);     /* map enabled? */
 PC = saved_PC;
 put_PSW (PSW, 0);                                       /* set PSW, call calc_xs */
@@ -694,6 +910,11 @@ dsenable = calc_ds (cm);
 put_PIRQ (PIRQ);                                        /* rewrite PIRQ */
 STKLIM = STKLIM & STKLIM_RW;                            /* clean up STKLIM */
 MMR0 = MMR0 | MMR0_IC;                                  /* usually on */
+int_summ = 0;                                           /* rebuild int summary */
+for (i = 0; i < IPL_HLVL; i++) {
+    if (int_req[i])
+        int_summ = int_summ | (1u << i);
+    }
 
 trap_req = calc_ints (ipl, trap_req);                   /* upd int req */
 trapea = 0;
@@ -822,12 +1043,13 @@ while (reason == 0)  {
                 MMR2 = trapea;
             MMR0 = MMR0 & ~MMR0_IC;                     /* clear IC */
             }
-        src = ReadW (trapea | calc_ds (MD_KER));        /* new PC */
-        src2 = ReadW ((trapea + 2) | calc_ds (MD_KER)); /* new PSW */
+        src = ReadW_fast (trapea | calc_ds (MD_KER));   /* new PC */
+        src2 = ReadW_fast ((trapea + 2) |               /* new PSW */
+            calc_ds (MD_KER));
         t = (src2 >> PSW_V_CM) & 03;                    /* new cm */
         trapea = ~t;                                    /* flag pushes */
-        WriteW (PSW, ((STACKFILE[t] - 2) & 0177777) | calc_ds (t));
-        WriteW (PC, ((STACKFILE[t] - 4) & 0177777) | calc_ds (t));
+        WriteW_fast (PSW, ((STACKFILE[t] - 2) & 0177777) | calc_ds (t));
+        WriteW_fast (PC, ((STACKFILE[t] - 4) & 0177777) | calc_ds (t));
         trapea = 0;                                     /* clear trap flag */
         src2 = (src2 & ~PSW_PM) | (cm << PSW_V_PM);     /* insert prv mode */
         put_PSW (src2, 0);                              /* call calc_is,ds */
@@ -867,7 +1089,7 @@ while (reason == 0)  {
         MMR1 = 0;
         MMR2 = PC;
         }
-    IR = ReadE (PC | isenable);                         /* fetch instruction */
+    IR = ReadE_fast (PC | isenable);                    /* fetch instruction */
     sim_interval = sim_interval - 1;
     srcspec = (IR >> 6) & 077;                          /* src, dst specs */
     dstspec = IR & 077;
@@ -930,8 +1152,10 @@ while (reason == 0)  {
                     MMR0 = 0;                           /* clear MMR0 */
                     MMR3 = 0;                           /* clear MMR3 */
                     cpu_bme = 0;                        /* (also clear bme) */
+                    tlb_flush ();                       /* flush TLB */
                     for (i = 0; i < IPL_HLVL; i++)
                         int_req[i] = 0;
+                    int_summ = 0;
                     trap_req = trap_req & ~TRAP_INT;
                     dsenable = calc_ds (cm);
                     }
@@ -942,8 +1166,8 @@ while (reason == 0)  {
                     break;
                     }
             case 2:                                     /* RTI */
-                src = ReadW (SP | dsenable);
-                src2 = ReadW (((SP + 2) & 0177777) | dsenable);
+                src = ReadW_fast (SP | dsenable);
+                src2 = ReadW_fast (((SP + 2) & 0177777) | dsenable);
                 STACKFILE[cm] = SP = (SP + 4) & 0177777;
                 oldrs = rs;
                 put_PSW (src2, (cm != MD_KER));         /* store PSW, prot */
@@ -986,7 +1210,7 @@ while (reason == 0)  {
             if (IR < 000210) {                          /* RTS */
                 dstspec = dstspec & 07;
                 JMP_PC (R[dstspec]);
-                R[dstspec] = ReadW (SP | dsenable);
+                R[dstspec] = ReadW_fast (SP | dsenable);
                 if (dstspec != 6)
                     SP = (SP + 2) & 0177777;
                 break;
@@ -1026,7 +1250,7 @@ while (reason == 0)  {
             break;                                      /* end case RTS et al */
 
         case 003:                                       /* SWAB */
-            dst = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = ((dst & 0377) << 8) | ((dst >> 8) & 0377);
             N = GET_SIGN_B (dst & 0377);
             Z = GET_Z (dst & 0377);
@@ -1035,7 +1259,7 @@ while (reason == 0)  {
             C = 0;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;                                      /* end SWAB */
 
         case 004: case 005:                             /* BR */
@@ -1129,7 +1353,7 @@ while (reason == 0)  {
                 SP = (SP - 2) & 0177777;
                 if (update_MM)
                     MMR1 = calc_MMR1 (0366);
-                WriteW (R[srcspec], SP | dsenable);
+                WriteW_fast (R[srcspec], SP | dsenable);
                 if ((cm == MD_KER) && (SP < (STKLIM + STKL_Y)))
                     set_stack_trap (SP);
                 R[srcspec] = PC;
@@ -1142,11 +1366,11 @@ while (reason == 0)  {
             Z = 1;
             if (dstreg)
                 R[dstspec] = 0;
-            else WriteW (0, GeteaW (dstspec));
+            else WriteW_fast (0, GeteaW (dstspec));
             break;
 
         case 051:                                       /* COM */
-            dst = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = dst ^ 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1154,33 +1378,33 @@ while (reason == 0)  {
             C = 1;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 052:                                       /* INC */
-            dst = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (dst + 1) & 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
             V = (dst == 0100000);
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 053:                                       /* DEC */
-            dst = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (dst - 1) & 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
             V = (dst == 077777);
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 054:                                       /* NEG */
-            dst = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (-dst) & 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1188,11 +1412,11 @@ while (reason == 0)  {
             C = Z ^ 1;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 055:                                       /* ADC */
-            dst = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (dst + C) & 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1200,11 +1424,11 @@ while (reason == 0)  {
             C = C & Z;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 056:                                       /* SBC */
-            dst = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (dst - C) & 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1212,18 +1436,18 @@ while (reason == 0)  {
             C = (C && (dst == 0177777));
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 057:                                       /* TST */
-            dst = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+            dst = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
             V = C = 0;
             break;
 
         case 060:                                       /* ROR */
-            src = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (src >> 1) | (C << 15);
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1231,11 +1455,11 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 061:                                       /* ROL */
-            src = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = ((src << 1) | C) & 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1243,11 +1467,11 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 062:                                       /* ASR */
-            src = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (src >> 1) | (src & 0100000);
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1255,11 +1479,11 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
         case 063:                                       /* ASL */
-            src = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             dst = (src << 1) & 0177777;
             N = GET_SIGN_W (dst);
             Z = GET_Z (dst);
@@ -1267,7 +1491,7 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = dst;
-            else PWriteW (dst, last_pa);
+            else PWriteW_fast (dst, last_pa);
             break;
 
 /* Notes:
@@ -1279,7 +1503,7 @@ while (reason == 0)  {
             if (CPUT (HAS_MARK)) {
                 i = (PC + dstspec + dstspec) & 0177777;
                 JMP_PC (R[5]);
-                R[5] = ReadW (i | dsenable);
+                R[5] = ReadW_fast (i | dsenable);
                 SP = (i + 2) & 0177777;
                 }
             else setTRAP (TRAP_ILL);
@@ -1294,7 +1518,7 @@ while (reason == 0)  {
                     }
                 else {
                     i = ((cm == pm) && (cm == MD_USR))? (int32)calc_ds (pm): (int32)calc_is (pm);
-                    dst = ReadW ((GeteaW (dstspec) & 0177777) | i);
+                    dst = ReadW_fast ((GeteaW (dstspec) & 0177777) | i);
                     }
                 N = GET_SIGN_W (dst);
                 Z = GET_Z (dst);
@@ -1302,7 +1526,7 @@ while (reason == 0)  {
                 SP = (SP - 2) & 0177777;
                 if (update_MM)
                     MMR1 = calc_MMR1 (0366);
-                WriteW (dst, SP | dsenable);
+                WriteW_fast (dst, SP | dsenable);
                 if ((cm == MD_KER) && (SP < (STKLIM + STKL_Y)))
                     set_stack_trap (SP);
                 }
@@ -1311,7 +1535,7 @@ while (reason == 0)  {
 
         case 066:                                       /* MTPI */
             if (CPUT (HAS_MXPY)) {
-                dst = ReadW (SP | dsenable);
+                dst = ReadW_fast (SP | dsenable);
                 N = GET_SIGN_W (dst);
                 Z = GET_Z (dst);
                 V = 0;
@@ -1322,7 +1546,7 @@ while (reason == 0)  {
                         STACKFILE[pm] = dst;
                     else R[dstspec] = dst;
                     }
-                else WriteW (dst, (GeteaW (dstspec) & 0177777) | calc_is (pm));
+                else WriteW_fast (dst, (GeteaW (dstspec) & 0177777) | calc_is (pm));
                 }
             else setTRAP (TRAP_ILL);
             break;
@@ -1334,39 +1558,39 @@ while (reason == 0)  {
                 V = 0;
                 if (dstreg)
                     R[dstspec] = dst;
-                else WriteW (dst, GeteaW (dstspec));
+                else WriteW_fast (dst, GeteaW (dstspec));
                 }
             else setTRAP (TRAP_ILL);
             break;
 
         case 070:                                       /* CSM */
             if (CPUT (HAS_CSM) && (MMR3 & MMR3_CSM) && (cm != MD_KER)) {
-                dst = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+                dst = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
                 PSW = get_PSW () & ~PSW_CC;             /* PSW, cc = 0 */
                 STACKFILE[cm] = SP;
-                WriteW (PSW, ((SP - 2) & 0177777) | calc_ds (MD_SUP));
-                WriteW (PC, ((SP - 4) & 0177777) | calc_ds (MD_SUP));
-                WriteW (dst, ((SP - 6) & 0177777) | calc_ds (MD_SUP));
+                WriteW_fast (PSW, ((SP - 2) & 0177777) | calc_ds (MD_SUP));
+                WriteW_fast (PC, ((SP - 4) & 0177777) | calc_ds (MD_SUP));
+                WriteW_fast (dst, ((SP - 6) & 0177777) | calc_ds (MD_SUP));
                 SP = (SP - 6) & 0177777;
                 pm = cm;
                 cm = MD_SUP;
                 tbit = 0;
                 isenable = calc_is (cm);
                 dsenable = calc_ds (cm);
-                PC = ReadW (010 | isenable);
+                PC = ReadW_fast (010 | isenable);
                 }
             else setTRAP (TRAP_ILL);
             break;
 
         case 072:                                       /* TSTSET */
             if (CPUT (HAS_TSWLK) && !dstreg) {
-                dst = ReadMW (GeteaW (dstspec));
+                dst = ReadMW_fast (GeteaW (dstspec));
                 N = GET_SIGN_W (dst);
                 Z = GET_Z (dst);
                 V = 0;
                 C = (dst & 1);
                 R[0] = dst;                             /* R[0] <- dst */
-                PWriteW (R[0] | 1, last_pa);            /* dst <- R[0] | 1 */
+                PWriteW_fast (R[0] | 1, last_pa);       /* dst <- R[0] | 1 */
                 }
             else setTRAP (TRAP_ILL);
             break;
@@ -1376,7 +1600,7 @@ while (reason == 0)  {
                 N = GET_SIGN_W (R[0]);
                 Z = GET_Z (R[0]);
                 V = 0;
-                WriteW (R[0], GeteaW (dstspec));
+                WriteW_fast (R[0], GeteaW (dstspec));
                 }
             else setTRAP (TRAP_ILL);
             break;
@@ -1404,7 +1628,7 @@ while (reason == 0)  {
             dst = R[srcspec];
             }
         else {
-            dst = srcreg? R[srcspec]: ReadW (GeteaW (srcspec));
+            dst = srcreg? R[srcspec]: ReadW_fast (GeteaW (srcspec));
             if (!dstreg)
                 ea = GeteaW (dstspec);
             }
@@ -1413,17 +1637,17 @@ while (reason == 0)  {
         V = 0;
         if (dstreg)
             R[dstspec] = dst;
-        else WriteW (dst, ea);
+        else WriteW_fast (dst, ea);
         break;
 
     case 002:                                           /* CMP */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadW (GeteaW (dstspec));
+            src2 = ReadW_fast (GeteaW (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadW (GeteaW (srcspec));
-            src2 = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+            src = srcreg? R[srcspec]: ReadW_fast (GeteaW (srcspec));
+            src2 = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
             }
         dst = (src - src2) & 0177777;
         N = GET_SIGN_W (dst);
@@ -1434,12 +1658,12 @@ while (reason == 0)  {
 
     case 003:                                           /* BIT */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadW (GeteaW (dstspec));
+            src2 = ReadW_fast (GeteaW (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadW (GeteaW (srcspec));
-            src2 = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+            src = srcreg? R[srcspec]: ReadW_fast (GeteaW (srcspec));
+            src2 = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
             }
         dst = src2 & src;
         N = GET_SIGN_W (dst);
@@ -1449,12 +1673,12 @@ while (reason == 0)  {
 
     case 004:                                           /* BIC */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadMW (GeteaW (dstspec));
+            src2 = ReadMW_fast (GeteaW (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadW (GeteaW (srcspec));
-            src2 = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = srcreg? R[srcspec]: ReadW_fast (GeteaW (srcspec));
+            src2 = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             }
         dst = src2 & ~src;
         N = GET_SIGN_W (dst);
@@ -1462,17 +1686,17 @@ while (reason == 0)  {
         V = 0;
         if (dstreg)
             R[dstspec] = dst;
-        else PWriteW (dst, last_pa);
+        else PWriteW_fast (dst, last_pa);
         break;
 
     case 005:                                           /* BIS */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadMW (GeteaW (dstspec));
+            src2 = ReadMW_fast (GeteaW (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadW (GeteaW (srcspec));
-            src2 = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = srcreg? R[srcspec]: ReadW_fast (GeteaW (srcspec));
+            src2 = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             }
         dst = src2 | src;
         N = GET_SIGN_W (dst);
@@ -1480,17 +1704,17 @@ while (reason == 0)  {
         V = 0;
         if (dstreg)
             R[dstspec] = dst;
-        else PWriteW (dst, last_pa);
+        else PWriteW_fast (dst, last_pa);
         break;
 
     case 006:                                           /* ADD */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadMW (GeteaW (dstspec));
+            src2 = ReadMW_fast (GeteaW (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadW (GeteaW (srcspec));
-            src2 = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = srcreg? R[srcspec]: ReadW_fast (GeteaW (srcspec));
+            src2 = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             }
         dst = (src2 + src) & 0177777;
         N = GET_SIGN_W (dst);
@@ -1499,7 +1723,7 @@ while (reason == 0)  {
         C = (dst < src);
         if (dstreg)
             R[dstspec] = dst;
-        else PWriteW (dst, last_pa);
+        else PWriteW_fast (dst, last_pa);
         break;
 
 /* Opcode 07: EIS, FIS, CIS
@@ -1528,7 +1752,7 @@ while (reason == 0)  {
                 setTRAP (TRAP_ILL);
                 break;
                 }
-            src2 = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+            src2 = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
             src = R[srcspec];
             if (GET_SIGN_W (src2))
                 src2 = src2 | ~077777;
@@ -1548,7 +1772,7 @@ while (reason == 0)  {
                 setTRAP (TRAP_ILL);
                 break;
                 }
-            src2 = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+            src2 = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
             src = (((uint32) R[srcspec]) << 16) | R[srcspec | 1];
             if (src2 == 0) {
                 N = 0;                                  /* J11,11/70 compat */
@@ -1582,7 +1806,7 @@ while (reason == 0)  {
                 setTRAP (TRAP_ILL);
                 break;
                 }
-            src2 = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+            src2 = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
             src2 = src2 & 077;
             sign = GET_SIGN_W (R[srcspec]);
             src = sign? R[srcspec] | ~077777: R[srcspec];
@@ -1621,7 +1845,7 @@ while (reason == 0)  {
                 setTRAP (TRAP_ILL);
                 break;
                 }
-            src2 = dstreg? R[dstspec]: ReadW (GeteaW (dstspec));
+            src2 = dstreg? R[dstspec]: ReadW_fast (GeteaW (dstspec));
             src2 = src2 & 077;
             sign = GET_SIGN_W (R[srcspec]);
             src = (((uint32) R[srcspec]) << 16) | R[srcspec | 1];
@@ -1654,12 +1878,12 @@ while (reason == 0)  {
         case 4:                                         /* XOR */
             if (CPUT (HAS_SXS)) {
                 if (CPUT (IS_SDSD) && !dstreg) {        /* R,not R */
-                    src2 = ReadMW (GeteaW (dstspec));
+                    src2 = ReadMW_fast (GeteaW (dstspec));
                     src = R[srcspec];
                     }
                 else {
                     src = R[srcspec];
-                    src2 = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+                    src2 = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
                     }
                 dst = src ^ src2;
                 N = GET_SIGN_W (dst);
@@ -1667,7 +1891,7 @@ while (reason == 0)  {
                 V = 0;
                 if (dstreg)
                     R[dstspec] = dst;
-                else PWriteW (dst, last_pa);
+                else PWriteW_fast (dst, last_pa);
                 }
             else setTRAP (TRAP_ILL);
             break;
@@ -1681,7 +1905,7 @@ while (reason == 0)  {
         case 6:                                         /* CIS */
             if (CPUT (CPUT_60) && (cm == MD_KER) &&     /* 11/60 MED? */
                 (IR == 076600)) {
-                ReadE (PC | isenable);                  /* read immediate */
+                ReadE_fast (PC | isenable);             /* read immediate */
                 PC = (PC + 2) & 0177777;
                 }
             else if (CPUO (OPT_CIS))                    /* CIS option? */
@@ -1815,11 +2039,11 @@ while (reason == 0)  {
             Z = 1;
             if (dstreg)
                 R[dstspec] = R[dstspec] & 0177400;
-            else WriteB (0, GeteaB (dstspec));
+            else WriteB_fast (0, GeteaB (dstspec));
             break;
 
         case 051:                                       /* COMB */
-            dst = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            dst = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = (dst ^ 0377) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1827,33 +2051,33 @@ while (reason == 0)  {
             C = 1;
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 052:                                       /* INCB */
-            dst = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            dst = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = (dst + 1) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
             V = (dst == 0200);
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 053:                                       /* DECB */
-            dst = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            dst = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = (dst - 1) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
             V = (dst == 0177);
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 054:                                       /* NEGB */
-            dst = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            dst = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = (-dst) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1861,11 +2085,11 @@ while (reason == 0)  {
             C = (Z ^ 1);
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 055:                                       /* ADCB */
-            dst = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            dst = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = (dst + C) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1873,11 +2097,11 @@ while (reason == 0)  {
             C = C & Z;
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 056:                                       /* SBCB */
-            dst = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            dst = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = (dst - C) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1885,18 +2109,18 @@ while (reason == 0)  {
             C = (C && (dst == 0377));
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 057:                                       /* TSTB */
-            dst = dstreg? R[dstspec] & 0377: ReadB (GeteaB (dstspec));
+            dst = dstreg? R[dstspec] & 0377: ReadB_fast (GeteaB (dstspec));
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
             V = C = 0;
             break;
 
         case 060:                                       /* RORB */
-            src = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            src = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = ((src & 0377) >> 1) | (C << 7);
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1904,11 +2128,11 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 061:                                       /* ROLB */
-            src = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            src = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = ((src << 1) | C) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1916,11 +2140,11 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 062:                                       /* ASRB */
-            src = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            src = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = ((src & 0377) >> 1) | (src & 0200);
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1928,11 +2152,11 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
         case 063:                                       /* ASLB */
-            src = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            src = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             dst = (src << 1) & 0377;
             N = GET_SIGN_B (dst);
             Z = GET_Z (dst);
@@ -1940,7 +2164,7 @@ while (reason == 0)  {
             V = N ^ C;
             if (dstreg)
                 R[dstspec] = (R[dstspec] & 0177400) | dst;
-            else PWriteB (dst, last_pa);
+            else PWriteB_fast (dst, last_pa);
             break;
 
 /* Notes:
@@ -1951,7 +2175,7 @@ while (reason == 0)  {
 
         case 064:                                       /* MTPS */
             if (CPUT (HAS_MXPS)) {
-                dst = dstreg? R[dstspec]: ReadB (GeteaB (dstspec));
+                dst = dstreg? R[dstspec]: ReadB_fast (GeteaB (dstspec));
                 if (cm == MD_KER) {
                     ipl = (dst >> PSW_V_IPL) & 07;
                     trap_req = calc_ints (ipl, trap_req);
@@ -1971,14 +2195,14 @@ while (reason == 0)  {
                         dst = STACKFILE[pm];
                     else dst = R[dstspec];
                     }
-                else dst = ReadW ((GeteaW (dstspec) & 0177777) | calc_ds (pm));
+                else dst = ReadW_fast ((GeteaW (dstspec) & 0177777) | calc_ds (pm));
                 N = GET_SIGN_W (dst);
                 Z = GET_Z (dst);
                 V = 0;
                 SP = (SP - 2) & 0177777;
                 if (update_MM)
                     MMR1 = calc_MMR1 (0366);
-                WriteW (dst, SP | dsenable);
+                WriteW_fast (dst, SP | dsenable);
                 if ((cm == MD_KER) && (SP < (STKLIM + STKL_Y)))
                     set_stack_trap (SP);
                 }
@@ -1987,7 +2211,7 @@ while (reason == 0)  {
 
         case 066:                                       /* MTPD */
             if (CPUT (HAS_MXPY)) {
-                dst = ReadW (SP | dsenable);
+                dst = ReadW_fast (SP | dsenable);
                 N = GET_SIGN_W (dst);
                 Z = GET_Z (dst);
                 V = 0;
@@ -1999,7 +2223,7 @@ while (reason == 0)  {
                         STACKFILE[pm] = dst;
                     else R[dstspec] = dst;
                     }
-                else WriteW (dst, (GeteaW (dstspec) & 0177777) | calc_ds (pm));
+                else WriteW_fast (dst, (GeteaW (dstspec) & 0177777) | calc_ds (pm));
                 }
             else setTRAP (TRAP_ILL);
             break;
@@ -2012,7 +2236,7 @@ while (reason == 0)  {
                 V = 0;
                 if (dstreg)
                     R[dstspec] = (dst & 0200)? 0177400 | dst: dst;
-                else WriteB (dst, GeteaB (dstspec));
+                else WriteB_fast (dst, GeteaB (dstspec));
                 }
             else setTRAP (TRAP_ILL);
             break;
@@ -2035,7 +2259,7 @@ while (reason == 0)  {
             dst = R[srcspec] & 0377;
             }
         else {
-            dst = srcreg? R[srcspec] & 0377: ReadB (GeteaB (srcspec));
+            dst = srcreg? R[srcspec] & 0377: ReadB_fast (GeteaB (srcspec));
             if (!dstreg)
                 ea = GeteaB (dstspec);
             }
@@ -2044,17 +2268,17 @@ while (reason == 0)  {
         V = 0;
         if (dstreg)
             R[dstspec] = (dst & 0200)? 0177400 | dst: dst;
-        else WriteB (dst, ea);
+        else WriteB_fast (dst, ea);
         break;
 
     case 012:                                           /* CMPB */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadB (GeteaB (dstspec));
+            src2 = ReadB_fast (GeteaB (dstspec));
             src = R[srcspec] & 0377;
             }
         else {
-            src = srcreg? R[srcspec] & 0377: ReadB (GeteaB (srcspec));
-            src2 = dstreg? R[dstspec] & 0377: ReadB (GeteaB (dstspec));
+            src = srcreg? R[srcspec] & 0377: ReadB_fast (GeteaB (srcspec));
+            src2 = dstreg? R[dstspec] & 0377: ReadB_fast (GeteaB (dstspec));
             }
         dst = (src - src2) & 0377;
         N = GET_SIGN_B (dst);
@@ -2065,12 +2289,12 @@ while (reason == 0)  {
 
     case 013:                                           /* BITB */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadB (GeteaB (dstspec));
+            src2 = ReadB_fast (GeteaB (dstspec));
             src = R[srcspec] & 0377;
             }
         else {
-            src = srcreg? R[srcspec] & 0377: ReadB (GeteaB (srcspec));
-            src2 = dstreg? R[dstspec] & 0377: ReadB (GeteaB (dstspec));
+            src = srcreg? R[srcspec] & 0377: ReadB_fast (GeteaB (srcspec));
+            src2 = dstreg? R[dstspec] & 0377: ReadB_fast (GeteaB (dstspec));
             }
         dst = (src2 & src) & 0377;
         N = GET_SIGN_B (dst);
@@ -2080,12 +2304,12 @@ while (reason == 0)  {
 
     case 014:                                           /* BICB */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadMB (GeteaB (dstspec));
+            src2 = ReadMB_fast (GeteaB (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadB (GeteaB (srcspec));
-            src2 = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            src = srcreg? R[srcspec]: ReadB_fast (GeteaB (srcspec));
+            src2 = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             }
         dst = (src2 & ~src) & 0377;
         N = GET_SIGN_B (dst);
@@ -2093,17 +2317,17 @@ while (reason == 0)  {
         V = 0;
         if (dstreg)
             R[dstspec] = (R[dstspec] & 0177400) | dst;
-        else PWriteB (dst, last_pa);
+        else PWriteB_fast (dst, last_pa);
         break;
 
     case 015:                                           /* BISB */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadMB (GeteaB (dstspec));
+            src2 = ReadMB_fast (GeteaB (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadB (GeteaB (srcspec));
-            src2 = dstreg? R[dstspec]: ReadMB (GeteaB (dstspec));
+            src = srcreg? R[srcspec]: ReadB_fast (GeteaB (srcspec));
+            src2 = dstreg? R[dstspec]: ReadMB_fast (GeteaB (dstspec));
             }
         dst = (src2 | src) & 0377;
         N = GET_SIGN_B (dst);
@@ -2111,17 +2335,17 @@ while (reason == 0)  {
         V = 0;
         if (dstreg)
             R[dstspec] = (R[dstspec] & 0177400) | dst;
-        else PWriteB (dst, last_pa);
+        else PWriteB_fast (dst, last_pa);
         break;
 
     case 016:                                           /* SUB */
         if (CPUT (IS_SDSD) && srcreg && !dstreg) {      /* R,not R */
-            src2 = ReadMW (GeteaW (dstspec));
+            src2 = ReadMW_fast (GeteaW (dstspec));
             src = R[srcspec];
             }
         else {
-            src = srcreg? R[srcspec]: ReadW (GeteaW (srcspec));
-            src2 = dstreg? R[dstspec]: ReadMW (GeteaW (dstspec));
+            src = srcreg? R[srcspec]: ReadW_fast (GeteaW (srcspec));
+            src2 = dstreg? R[dstspec]: ReadMW_fast (GeteaW (dstspec));
             }
         dst = (src2 - src) & 0177777;
         N = GET_SIGN_W (dst);
@@ -2130,7 +2354,7 @@ while (reason == 0)  {
         C = (src2 < src);
         if (dstreg)
             R[dstspec] = dst;
-        else PWriteW (dst, last_pa);
+        else PWriteW_fast (dst, last_pa);
         break;
 
 /* Opcode 17: floating point */
@@ -2225,7 +2449,7 @@ switch (spec >> 3) {                                    /* decode spec<5:3> */
         R[reg] = ((adr = R[reg]) + 2) & 0177777;
         if (update_MM && (reg != 7))
             MMR1 = calc_MMR1 (020 | reg);
-        adr = ReadW (adr | ds);
+        adr = ReadW_fast (adr | ds);
         return (adr | dsenable);
 
     case 4:                                             /* -(R) */
@@ -2242,18 +2466,18 @@ switch (spec >> 3) {                                    /* decode spec<5:3> */
             MMR1 = calc_MMR1 (0360 | reg);
         if ((reg == 6) && (cm == MD_KER) && (adr < (STKLIM + STKL_Y)))
             set_stack_trap (adr);
-        adr = ReadW (adr | ds);
+        adr = ReadW_fast (adr | ds);
         return (adr | dsenable);
 
     case 6:                                             /* d(r) */
-        adr = ReadW (PC | isenable);
+        adr = ReadW_fast (PC | isenable);
         PC = (PC + 2) & 0177777;
         return (((R[reg] + adr) & 0177777) | dsenable);
 
     case 7:                                             /* @d(R) */
-        adr = ReadW (PC | isenable);
+        adr = ReadW_fast (PC | isenable);
         PC = (PC + 2) & 0177777;
-        adr = ReadW (((R[reg] + adr) & 0177777) | dsenable);
+        adr = ReadW_fast (((R[reg] + adr) & 0177777) | dsenable);
         return (adr | dsenable);
         }                                               /* end switch */
 }
@@ -2283,7 +2507,7 @@ switch (spec >> 3) {                                    /* decode spec<5:3> */
         R[reg] = ((adr = R[reg]) + 2) & 0177777;
         if (update_MM && (reg != 7))
             MMR1 = calc_MMR1 (020 | reg);
-        adr = ReadW (adr | ds);
+        adr = ReadW_fast (adr | ds);
         return (adr | dsenable);
 
     case 4:                                             /* -(R) */
@@ -2301,18 +2525,18 @@ switch (spec >> 3) {                                    /* decode spec<5:3> */
             MMR1 = calc_MMR1 (0360 | reg);
         if ((reg == 6) && (cm == MD_KER) && (adr < (STKLIM + STKL_Y)))
             set_stack_trap (adr);
-        adr = ReadW (adr | ds);
+        adr = ReadW_fast (adr | ds);
         return (adr | dsenable);
 
     case 6:                                             /* d(r) */
-        adr = ReadW (PC | isenable);
+        adr = ReadW_fast (PC | isenable);
         PC = (PC + 2) & 0177777;
         return (((R[reg] + adr) & 0177777) | dsenable);
 
     case 7:                                             /* @d(R) */
-        adr = ReadW (PC | isenable);
+        adr = ReadW_fast (PC | isenable);
         PC = (PC + 2) & 0177777;
-        adr = ReadW (((R[reg] + adr) & 0177777) | dsenable);
+        adr = ReadW_fast (((R[reg] + adr) & 0177777) | dsenable);
         return (adr | dsenable);
         }                                               /* end switch */
 }
@@ -2810,6 +3034,7 @@ switch ((pa >> 1) & 3) {                                /* decode pa<2:1> */
             data = (pa & 1)? (MMR0 & 0377) | (data << 8): (MMR0 & ~0377) | data;
         data = data & cpu_tab[cpu_model].mm0;
         MMR0 = (MMR0 & ~MMR0_WR) | (data & MMR0_WR);
+        tlb_flush ();                                   /* flush TLB */
         return SCPE_OK;
 
     default:                                            /* MMR1, MMR2 */
@@ -2830,6 +3055,7 @@ if (pa & 1)
 MMR3 = data & cpu_tab[cpu_model].mm3;
 cpu_bme = (MMR3 & MMR3_BME) && (cpu_opt & OPT_UBM);
 dsenable = calc_ds (cm);
+tlb_flush ();                                           /* flush TLB */
 return SCPE_OK;
 }
 
@@ -2887,6 +3113,7 @@ if (left)
         (((uint32) (data & cpu_tab[cpu_model].par)) << 16)) & ~(PDR_A|PDR_W);
 else APRFILE[idx] = ((APRFILE[idx] & ~0177777) |
     (data & cpu_tab[cpu_model].pdr)) & ~(PDR_A|PDR_W);
+cpu_tlb[idx].acc = 0;                                   /* flush entry */
 return SCPE_OK;
 }
 
@@ -3053,7 +3280,7 @@ MMR3 = 0;
 trap_req = 0;
 wait_state = 0;
 if (M == NULL) {                    /* First time init */
-    M = (uint16 *) calloc (MEMSIZE >> 1, sizeof (uint16));
+    M = (uint16 *) sim_mem_alloc ((size_t) MEMSIZE, (size_t) MAXMEMSIZE);
     if (M == NULL)
         return SCPE_MEM;
     sim_set_pchar (0, "01000023640"); /* ESC, CR, LF, TAB, BS, BEL, ENQ */
@@ -1145,7 +1145,7 @@ return SCPE_OK;
 t_stat cpu_set_size (UNIT *uptr, int32 val, char *cptr, void *desc)
 {
 int32 mc = 0;
-uint32 i, clim;
+uint32 i;
 uint16 *nM;
 
 if ((val <= 0) ||
@@ -1156,13 +1156,9 @@ for (i = val; i < MEMSIZE; i = i + 2)
     mc = mc | M[i >> 1];
 if ((mc != 0) && !get_yn ("Really truncate memory [N]?", FALSE))
     return SCPE_OK;
-nM = (uint16 *) calloc (val >> 1, sizeof (uint16));
+nM = (uint16 *) sim_mem_realloc (M, (size_t) val);     /* resize in place */
 if (nM == NULL)
     return SCPE_MEM;
-clim = (((t_addr) val) < MEMSIZE)? (uint32)val: MEMSIZE;
-for (i = 0; i < clim; i = i + 2)
-    nM[i >> 1] = M[i >> 1];
-free (M);
 M = nM;
 MEMSIZE = val;
 if (!(sim_switches & SIM_SW_REST))                      /* unless restore, */
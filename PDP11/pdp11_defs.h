@@ -109,6 +109,11 @@
 #define DMASK           0177777
 #define BMASK           0377
 
+/* CPU unit flags shared with the I/O routines */
+
+#define UNIT_V_NOFAST   (UNIT_V_UF + 1)                 /* reference paths only */
+#define UNIT_NOFAST     (1u << UNIT_V_NOFAST)
+
 /* CPU models */
 
 #define MOD_1103        0
@@ -777,12 +782,21 @@ typedef struct pdp_dib DIB;
 #define VEC_TTI         0060
 #define VEC_TTO         0064
 
-/* Interrupt macros */
+/* Interrupt macros
+
+   int_summ has one bit per level of int_req, set when that level has any
+   request pending.  SET_INT and CLR_INT keep it current; code that writes
+   int_req directly must update it as well.
+*/
+
+extern int32 int_summ;
 
 #define IVCL(dv)        ((IPL_##dv * 32) + INT_V_##dv)
 #define IREQ(dv)        int_req[IPL_##dv]
-#define SET_INT(dv)     int_req[IPL_##dv] = int_req[IPL_##dv] | (INT_##dv)
-#define CLR_INT(dv)     int_req[IPL_##dv] = int_req[IPL_##dv] & ~(INT_##dv)
+#define SET_INT(dv)     (int_req[IPL_##dv] = int_req[IPL_##dv] | (INT_##dv), \
+                         int_summ = int_summ | (1u << IPL_##dv))
+#define CLR_INT(dv)     (int_req[IPL_##dv] = int_req[IPL_##dv] & ~(INT_##dv), \
+                         int_summ = int_summ & ~((int_req[IPL_##dv] == 0) << IPL_##dv))
 #define INT_IS_SET(dv)  (int_req[IPL_##dv] & (INT_##dv))
 
 /* Massbus definitions */
@@ -811,6 +825,7 @@ int32 Map_ReadB (uint32 ba, int32 bc, uint8 *buf);
 int32 Map_ReadW (uint32 ba, int32 bc, uint16 *buf);
 int32 Map_WriteB (uint32 ba, int32 bc, uint8 *buf);
 int32 Map_WriteW (uint32 ba, int32 bc, uint16 *buf);
+uint8 *Map_Run (uint32 ba, int32 bc, int32 *run);
 
 int32 mba_rdbufW (uint32 mbus, int32 bc, uint16 *buf);
 int32 mba_wrbufW (uint32 mbus, int32 bc, uint16 *buf);
@@ -51,6 +51,8 @@
 
 #include "pdp11_defs.h"
 
+#define MAP_BY_RUNS     (sim_end && !(cpu_unit.flags & UNIT_NOFAST))
+
 extern uint16 *M;
 extern int32 int_req[IPL_HLVL];
 extern int32 ub_map[UBM_LNT_LW];
@@ -61,6 +63,7 @@ extern int32 cpu_log;
 extern int32 autcon_enb;
 extern int32 uba_last;
 extern DEVICE cpu_dev;
+extern UNIT cpu_unit;
 extern t_addr cpu_memsize;
 
 int32 calc_ints (int32 nipl, int32 trq);
@@ -127,19 +130,25 @@ return SCPE_NXM;
 }
 
 /* Calculate interrupt outstanding
-   In a Qbus system, all device interrupts are treated as BR4 */
+   In a Qbus system, all device interrupts are treated as BR4
+
+   The levels above nipl with requests pending come from int_summ; only
+   a Qbus system at or above BR4 needs to look at the requests themselves.
+*/
 
 int32 calc_ints (int32 nipl, int32 trq)
 {
 int32 i, t;
-t_bool all_int = (UNIBUS || (nipl < IPL_HMIN));
 
-for (i = IPL_HLVL - 1; i > nipl; i--) {
-    t = all_int? int_req[i]: (int_req[i] & int_internal[i]);
-    if (t)
-        return (trq | TRAP_INT);
+t = int_summ & ~((2u << nipl) - 1);                     /* levels above ipl */
+if (t && !UNIBUS && (nipl >= IPL_HMIN)) {               /* Qbus, ipl >= 4? */
+    for (i = IPL_HLVL - 1; i > nipl; i--) {             /* internal reqs only */
+        if (int_req[i] & int_internal[i])
+            return (trq | TRAP_INT);
+        }
+    return (trq & ~TRAP_INT);
     }
-return (trq & ~TRAP_INT);
+return (t? (trq | TRAP_INT): (trq & ~TRAP_INT));
 }
 
 /* Find vector for highest priority interrupt
@@ -151,10 +160,14 @@ int32 i, j, t, vec;
 t_bool all_int = (UNIBUS || (nipl < IPL_HMIN));
 
 for (i = IPL_HLVL - 1; i > nipl; i--) {                 /* loop thru lvls */
+    if (((int_summ >> i) & 1) == 0)                     /* nothing pending? */
+        continue;
     t = all_int? int_req[i]: (int_req[i] & int_internal[i]);
     for (j = 0; t && (j < 32); j++) {                   /* srch level */
         if ((t >> j) & 1) {                             /* irq found? */
             int_req[i] = int_req[i] & ~(1u << j);       /* clr irq */
+            if (int_req[i] == 0)                        /* level now idle? */
+                int_summ = int_summ & ~(1u << i);
             if (int_ack[i][j])
                 vec = int_ack[i][j]();
             else
@@ -220,6 +233,46 @@ else uba_last = (IOPAGEBASE + off) & PAMASK;            /* yes, use fixed */
 return uba_last;
 }
 
+/* Map a run of bus addresses to host memory
+
+   Returns a pointer to the host byte for bus address ba, and sets *run
+   to the number of bytes, at most bc, that follow it contiguously in
+   memory: to the end of the map page if the map is enabled, else to
+   the end of the transfer; either way, no further than the end of
+   memory.  Returns NULL if ba is in the I/O page or nonexistent, if
+   the host is big-endian (M[] is then not in bus byte order), or if
+   SET CPU NOFAST has selected the reference paths.
+
+   A DMA device can use this to move data directly between memory and
+   its own buffers, one run at a time, without an intermediate copy.
+   The Map_ routines below are built on it.
+*/
+
+uint8 *Map_Run (uint32 ba, int32 bc, int32 *run)
+{
+uint32 ma, n;
+
+if (!MAP_BY_RUNS || (ba >= IOPAGEBASE))                 /* not bytes, I/O? */
+    return NULL;
+ba = ba & BUSMASK;                                      /* trim address */
+if (cpu_bme) {                                          /* map enabled? */
+    ma = Map_Addr (ba);                                 /* map addr */
+    n = UBM_PAGSIZE - UBM_GETOFF (ba);                  /* rest of page */
+    }
+else {
+    ma = ba;
+    n = (uint32) bc;
+    }
+if (!ADDR_IS_MEM (ma))                                  /* NXM? */
+    return NULL;
+if (n > (uint32) bc)
+    n = (uint32) bc;
+if (n > (cpu_memsize - ma))                             /* clip at mem end */
+    n = (uint32) (cpu_memsize - ma);
+*run = (int32) n;
+return ((uint8 *) M) + ma;
+}
+
 /* I/O buffer routines, aligned access
 
    Map_ReadB    -       fetch byte buffer from memory
@@ -238,8 +291,34 @@ return uba_last;
      trimmed to 18b.
    - In a Qbus configuration, the map is always disabled.
      Device addresses are trimmed to 22b.
+
+   On little-endian hosts, memory transfers are done a map page at a
+   time with memcpy (see Map_Run).  On big-endian hosts, they are done
+   a byte or word at a time.
 */
 
+/* Copy between a buffer and memory by runs - little-endian hosts only */
+
+static int32 Map_Copy (uint32 ba, int32 bc, uint8 *buf, t_bool rd, int32 step)
+{
+uint8 *mp;
+int32 n;
+
+while (bc > 0) {
+    if ((mp = Map_Run (ba, bc, &n)) == NULL)            /* NXM? */
+        return bc;
+    if (rd)
+        memcpy (buf, mp, n);
+    else memcpy (mp, buf, n);
+    if (cpu_bme)                                        /* last mapped addr */
+        uba_last = (uba_last + n - step) & PAMASK;
+    buf = buf + n;
+    ba = ba + n;
+    bc = bc - n;
+    }
+return 0;
+}
+
 int32 Map_ReadB (uint32 ba, int32 bc, uint8 *buf)
 {
 uint32 alim, lim, ma;
@@ -256,6 +335,8 @@ if (ba >= IOPAGEBASE) {
         }
     return bc;
     }
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba, bc, buf, TRUE, 1);
 ba = ba & BUSMASK;                                      /* trim address */
 lim = ba + bc;
 if (cpu_bme) {                                          /* map enabled? */
@@ -301,6 +382,8 @@ if (ba >= IOPAGEBASE) {
         }
     return bc;
     }
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba & ~01, bc & ~01, (uint8 *) buf, TRUE, 2);
 ba = (ba & BUSMASK) & ~01;                              /* trim, align addr */
 lim = ba + (bc & ~01);
 if (cpu_bme) {                                          /* map enabled? */
@@ -338,6 +421,8 @@ if (ba >= IOPAGEBASE) {
         }
     return bc;
 }
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba, bc, buf, FALSE, 1);
 ba = ba & BUSMASK;                                      /* trim address */
 lim = ba + bc;
 if (cpu_bme) {                                          /* map enabled? */
@@ -381,6 +466,8 @@ if (ba >= IOPAGEBASE) {
         }
     return bc;
 }
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba & ~01, bc & ~01, (uint8 *) buf, FALSE, 2);
 ba = (ba & BUSMASK) & ~01;                              /* trim, align addr */
 lim = ba + (bc & ~01);
 if (cpu_bme) {                                          /* map enabled? */
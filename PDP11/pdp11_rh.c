@@ -723,6 +723,7 @@ if (mb >= MBA_NUM)
     return;
 dibp = (DIB *) mba_dev[mb].ctxt;
 int_req[dibp->vloc >> 5] |= (1 << (dibp->vloc & 037));
+int_summ = int_summ | (1u << (dibp->vloc >> 5));        /* level pending */
 return;
 }
 
@@ -734,6 +735,8 @@ if (mb >= MBA_NUM)
     return;
 dibp = (DIB *) mba_dev[mb].ctxt;
 int_req[dibp->vloc >> 5] &= ~(1 << (dibp->vloc & 037));
+if (int_req[dibp->vloc >> 5] == 0)                      /* level now idle? */
+    int_summ = int_summ & ~(1u << (dibp->vloc >> 5));
 return;
 }
 
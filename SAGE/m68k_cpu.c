@@ -281,17 +281,67 @@ static t_stat ReadICache(t_addr tpc)
     return SCPE_OK;
 }
 
+/* page fetch cache: once a page of code is known to be plain contiguous memory,
+ * instruction words are read straight from it. Pages containing I/O or which Mem
+ * does not map contiguously always take the prefetch path above. Reading memory
+ * directly keeps self-modifying code and DMA visible; anything that changes the
+ * mapping itself must call m68k_flush_icache.
+ */
+#define ICACHE_SIZE 256
+#define ICACHE_MASK 0xff
+
+static t_addr icache_pc;
+static uint8* icache_mem = NULL;
+static t_addr icache_nopc;          /* last page found not cacheable */
+static t_bool icache_noval = FALSE;
+
+void m68k_flush_icache()
+{
+    icache_mem = NULL;
+    icache_noval = FALSE;
+}
+
+static void FillPageCache(t_addr pc)
+{
+    int i;
+    t_addr tpc,tpage;
+    IOHANDLER* ioh;
+    uint8 *mem,*end;
+
+    pc &= ~ICACHE_MASK;
+    if (icache_noval && pc == icache_nopc) return;
+    icache_nopc = pc;
+    icache_noval = TRUE;
+    for (i=0; i<ICACHE_SIZE; i+=CACHE_SIZE) {
+        if (TranslateAddr(pc+i,&tpc,&ioh,MEM_READ,FALSE,FALSE) != SCPE_OK) return;
+        if (i==0) tpage = tpc;
+        else if (tpc != tpage+i) return;
+    }
+    if (Mem(tpage,&mem) != SCPE_OK || Mem(tpage+ICACHE_SIZE-1,&end) != SCPE_OK) return;
+    if (end != mem+ICACHE_SIZE-1) return;
+    icache_noval = FALSE;
+    icache_pc = pc;
+    icache_mem = mem;
+}
+
 static t_stat ReadInstr(t_addr pc,uint32* inst)
 {
     t_stat rc;
     t_addr tpc;
     IOHANDLER* ioh;
+    uint8* mem;
     
+    if (icache_mem && (pc-icache_pc) < ICACHE_SIZE-1 && !sim_brk_summ) {
+        mem = icache_mem + (pc-icache_pc);
+        *inst = (mem[0]<<8) | mem[1];
+        return SCPE_OK;
+    }
     if ((rc=TranslateAddr(pc & ~CACHE_MASK,&tpc,&ioh,MEM_READ,FALSE,FALSE)) != SCPE_OK)
         return rc==SIM_ISIO ? STOP_PCIO : rc;
     if (tpc != cache_pc) {
         ASSERT_OKRET(ReadICache(tpc));
     }
+    if (!sim_brk_summ) FillPageCache(pc);
     pc &= CACHE_MASK;
     *inst = (cache_line[pc]<<8) | cache_line[pc+1];
     return SCPE_OK;
@@ -392,6 +442,7 @@ t_stat m68kcpu_reset(DEVICE* dptr)
     /* TODO: 68010 VBR */
     ReadPL(0,&A7);
     ReadPL(4,&saved_PC);
+    m68k_flush_icache();
     ReadInstr(saved_PC,&dummy); /* fill prefetch cache */
     m68k_irqinit();             /* reset interrupt flags */
     m68k_set_s(TRUE);           /* reset to supervisor mode */
@@ -1385,6 +1436,7 @@ t_stat sim_instr()
     PC = saved_PC;
     rc = 0;
     tracet0 = 0;
+    m68k_flush_icache();        /* memory or i/o map may have changed */
 
     /* the big main loop */
     while (rc == SCPE_OK) {
@@ -190,6 +190,7 @@ extern t_stat (*TranslateAddr)(t_addr in,t_addr* out,IOHANDLER** ioh,int rw,int
 extern t_stat m68k_translateaddr(t_addr in,t_addr* out,IOHANDLER** ioh,int rw,int fc,int dma);
 extern t_stat (*Mem)(t_addr a,uint8** mem);
 extern t_stat m68k_mem(t_addr a,uint8** mem);
+extern void m68k_flush_icache();
 
 /* cpu_mod for alternative implementations */
 extern t_stat m68k_set_cpu(UNIT *uptr, int32 value, char *cptr, void *desc);
@@ -167,6 +167,7 @@ static t_stat sage_mem(t_addr addr,uint8** mem)
     }
     a = addr - 0xfe0000;            /* boot rom at normal ROM page */
     if (a < MAX_ROMSIZE) {
+        if (rom_enable) m68k_flush_icache(); /* zero page becomes RAM */
         rom_enable = FALSE;
         *mem = ROM+a;
         return SCPE_OK;
@@ -500,6 +500,8 @@ MTAB cpu_mod[] = {
     { UNIT_CONH, UNIT_CONH, "HALT to console", "CONHALT", NULL, NULL, NULL, "Set HALT to trap to console ROM" },
     { MTAB_XTD|MTAB_VDV, 0, "IDLE", "IDLE={VMS|ULTRIX|NETBSD|OPENBSD|ULTRIXOLD|OPENBSDOLD|QUASIJARUS|32V|ELN|ALL}", &cpu_set_idle, &cpu_show_idle, NULL, "Display idle detection mode" },
     { MTAB_XTD|MTAB_VDV, 0, NULL, "NOIDLE", &sim_clr_idle, NULL, NULL,  "Disables idle detection" },
+    { UNIT_NOFAST, 0, NULL, "FAST", NULL, NULL, NULL, "Use string and floating point fast paths" },
+    { UNIT_NOFAST, UNIT_NOFAST, "NOFAST", "NOFAST", NULL, NULL, NULL, "Use only the reference instruction paths" },
     MEM_MODIFIERS,   /* Model specific memory modifiers from vaxXXX_defs.h */
     { MTAB_XTD|MTAB_VDV|MTAB_NMO|MTAB_SHP, 0, "HISTORY", "HISTORY",
       &cpu_set_hist, &cpu_show_hist, NULL, "Displays instruction history" },
@@ -3243,7 +3245,7 @@ if (M == NULL) {                        /* first time init? */
     if (pcq_r == NULL)
         return SCPE_IERR;
     pcq_r->qptr = 0;
-    M = (uint32 *) calloc (((uint32) MEMSIZE) >> 2, sizeof (uint32));
+    M = (uint32 *) sim_mem_alloc ((size_t) MEMSIZE, (size_t) MAXMEMSIZE_X);
     if (M == NULL)
         return SCPE_MEM;
     auto_config(NULL, 0);               /* do an initial auto configure */
@@ -3348,7 +3350,7 @@ return SCPE_NXM;
 t_stat cpu_set_size (UNIT *uptr, int32 val, char *cptr, void *desc)
 {
 int32 mc = 0;
-uint32 i, clim, uval = (uint32)val;
+uint32 i, uval = (uint32)val;
 uint32 *nM = NULL;
 
 if ((val <= 0) || (val > MAXMEMSIZE_X))
@@ -3357,13 +3359,9 @@ for (i = val; i < MEMSIZE; i = i + 4)
     mc = mc | M[i >> 2];
 if ((mc != 0) && !get_yn ("Really truncate memory [N]?", FALSE))
     return SCPE_OK;
-nM = (uint32 *) calloc (uval >> 2, sizeof (uint32));
+nM = (uint32 *) sim_mem_realloc (M, (size_t) uval);    /* resize in place */
 if (nM == NULL)
     return SCPE_MEM;
-clim = (uint32)((uval < MEMSIZE)? uval: MEMSIZE);
-for (i = 0; i < clim; i = i + 4)
-    nM[i >> 2] = M[i >> 2];
-free (M);
 M = nM;
 MEMSIZE = uval; 
 reset_all (0);
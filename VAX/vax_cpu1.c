@@ -613,6 +613,16 @@ return cc;
         the intermediate entries that are "touched" in any way must be
         QUADWORD aligned.  In addition, the header and  the entry must
         not be equal.
+
+        The simulated systems are uniprocessors, and all DMA is done on
+        the CPU thread, so nothing can reference memory between an
+        instruction's read of the header and its write.  The secondary
+        interlock (bit 0 of the header) is therefore taken and released
+        with ordinary reads and writes, as are the bits of BBSSI and
+        BBCCI.  A multiprocessor model with one host thread per CPU
+        would have to take it with a host atomic operation on M, and
+        would also need per-CPU copies of the CPU, TLB and interrupt
+        state, which are now globals.
 */
 
 int32 op_insqhi (int32 *opnd, int32 acc)
@@ -797,6 +807,20 @@ return 0;                                               /* q can't be empty */
 #define MVC_M_STATE     3
 #define MVC_V_CC        2
 
+/* Block fast paths
+
+   Each string instruction first works through its operands a page run
+   at a time, using MapBlk to translate each operand once per page and
+   host memmove/memset/memcmp/memchr on the span.  The architectural
+   registers are updated after every run, and a run only ends where the
+   original loop would be between references, so those loops can take
+   over at any run boundary.  Anything MapBlk cannot map (a page that
+   would fault, I/O space, nonexistent memory, big endian host) is left
+   to the original loops, which take the fault or finish the instruction.
+*/
+
+#define STR_MIN(a,b)    (((a) < (b))? (a): (b))
+
 /* MOVC3, MOVC5
 
    if PSL<fpd> = 0 and MOVC3,
@@ -824,6 +848,8 @@ int32 op_movc (int32 *opnd, int32 movc5, int32 acc)
 {
 int32 i, cc, fill, wd;
 int32 j, lnt, mlnt[3];
+int32 n, h, srun, drun;
+uint8 *sp, *dp;
 static const int32 looplnt[3] = { L_BYTE, L_LONG, L_BYTE };
 
 if (PSL & PSL_FPD) {                                    /* FPD set? */
@@ -870,11 +896,41 @@ else {
         R3      =       current dst addr
         R4      =       dst length - src length
         R5      =       cc'state
+
+   The move loops below make byte references up to a longword aligned
+   destination, longword references, then byte references for the tail.
+   A page run that would stop inside the longword part is cut back to a
+   longword boundary, and a source longword that crosses a page is moved
+   with the same Read and Write as the loop, so a fault leaves the
+   registers and memory exactly as the loop would have.
 */
 
 switch (R[5] & MVC_M_STATE) {                           /* case on state */
 
     case MVC_FRWD:                                      /* move forward */
+        while (R[2] > 0) {                              /* page runs */
+            if ((sp = MapBlk (R[1], RA, FALSE, &srun)) == NULL)
+                break;
+            h = (4 - R[3]) & 3;                         /* loop head length */
+            if ((h == 0) && (srun < 4) && (R[2] >= 4)) {  /* lw spans pages? */
+                wd = Read (R[1], L_LONG, RA);           /* as the loop does */
+                Write (R[3], wd, L_LONG, WA);
+                R[1] = R[1] + 4;
+                R[3] = R[3] + 4;
+                R[2] = R[2] - 4;
+                continue;
+                }
+            if ((dp = MapBlk (R[3], WA, FALSE, &drun)) == NULL)
+                break;
+            n = STR_MIN (STR_MIN (srun, drun), R[2]);
+            if ((n > h) && (n < (R[2] - ((R[2] - h) & 3))))
+                n = n - ((n - h) & 3);                  /* end on a lw */
+            memmove (dp, sp, n);                        /* move run */
+            R[1] = R[1] + n;                            /* inc src addr */
+            R[3] = R[3] + n;                            /* inc dst addr */
+            R[2] = R[2] - n;                            /* dec move lnt */
+            sim_interval = sim_interval - (n >> 2);
+            }
         mlnt[0] = (4 - R[3]) & 3;                       /* length to align */
         if (mlnt[0] > R[2])                             /* cant exceed total */
             mlnt[0] = R[2];
@@ -893,6 +949,29 @@ switch (R[5] & MVC_M_STATE) {                           /* case on state */
         goto FILL;                                      /* check for fill */
 
     case MVC_BACK:                                      /* move backward */
+        while (R[2] > 0) {                              /* page runs */
+            if ((sp = MapBlk (R[1] - 1, RA, TRUE, &srun)) == NULL)
+                break;
+            h = R[3] & 3;                               /* loop head length */
+            if ((h == 0) && (srun < 4) && (R[2] >= 4)) {  /* lw spans pages? */
+                wd = Read (R[1] - 4, L_LONG, RA);       /* as the loop does */
+                Write (R[3] - 4, wd, L_LONG, WA);
+                R[1] = R[1] - 4;
+                R[3] = R[3] - 4;
+                R[2] = R[2] - 4;
+                continue;
+                }
+            if ((dp = MapBlk (R[3] - 1, WA, TRUE, &drun)) == NULL)
+                break;
+            n = STR_MIN (STR_MIN (srun, drun), R[2]);
+            if ((n > h) && (n < (R[2] - ((R[2] - h) & 3))))
+                n = n - ((n - h) & 3);                  /* end on a lw */
+            memmove (dp - n + 1, sp - n + 1, n);        /* move run */
+            R[1] = R[1] - n;                            /* dec src addr */
+            R[3] = R[3] - n;                            /* dec dst addr */
+            R[2] = R[2] - n;                            /* dec move lnt */
+            sim_interval = sim_interval - (n >> 2);
+            }
         mlnt[0] = R[3] & 03;                            /* length to align */
         if (mlnt[0] > R[2])                             /* cant exceed total */
             mlnt[0] = R[2];
@@ -916,6 +995,15 @@ switch (R[5] & MVC_M_STATE) {                           /* case on state */
         if (R[4] <= 0)                                  /* any fill? */
             break;
         R[5] = R[5] | MVC_FILL;                         /* set state */
+        while (R[4] > 0) {                              /* page runs */
+            if ((dp = MapBlk (R[3], WA, FALSE, &drun)) == NULL)
+                break;
+            n = STR_MIN (drun, R[4]);
+            memset (dp, fill & BMASK, n);               /* fill run */
+            R[3] = R[3] + n;                            /* inc dst addr */
+            R[4] = R[4] - n;                            /* dec fill lnt */
+            sim_interval = sim_interval - (n >> 2);
+            }
         mlnt[0] = (4 - R[3]) & 3;                       /* length to align */
         if (mlnt[0] > R[4])                             /* cant exceed total */
             mlnt[0] = R[4];
@@ -969,6 +1057,8 @@ return cc;
 int32 op_cmpc (int32 *opnd, int32 cmpc5, int32 acc)
 {
 int32 cc, s1, s2, fill;
+int32 i, n, run1, run2;
+uint8 *p1, *p2;
 
 if (PSL & PSL_FPD) {                                    /* FPD set? */
     SETPC (fault_PC + STR_GETDPC (R[0]));               /* reset PC */
@@ -990,6 +1080,22 @@ else {
     PSL = PSL | PSL_FPD;
     }
 R[2] = R[2] & STR_LNMASK;                               /* mask src2len */
+while ((R[0] & STR_LNMASK) && R[2]) {                   /* page runs */
+    if (((p1 = MapBlk (R[1], RA, FALSE, &run1)) == NULL) ||
+        ((p2 = MapBlk (R[3], RA, FALSE, &run2)) == NULL))
+        break;
+    n = STR_MIN (STR_MIN (run1, run2), STR_MIN (R[0] & STR_LNMASK, R[2]));
+    if (memcmp (p1, p2, n) == 0)                        /* whole run equal? */
+        i = n;
+    else for (i = 0; p1[i] == p2[i]; i++) ;             /* find mismatch */
+    R[0] = (R[0] & ~STR_LNMASK) | ((R[0] - i) & STR_LNMASK);
+    R[1] = R[1] + i;
+    R[2] = R[2] - i;
+    R[3] = R[3] + i;
+    sim_interval = sim_interval - i;
+    if (i < n)                                          /* mismatch? */
+        break;
+    }
 for (s1 = s2 = 0; ((R[0] | R[2]) & STR_LNMASK) != 0; sim_interval--) {
     if (R[0] & STR_LNMASK)                              /* src1? read */
         s1 = Read (R[1], L_BYTE, RA);
@@ -1029,6 +1135,8 @@ return cc;
 int32 op_locskp (int32 *opnd, int32 skpc, int32 acc)
 {
 int32 c, match;
+int32 i, n, run;
+uint8 *sp, *mp;
 
 if (PSL & PSL_FPD) {                                    /* FPD set? */
     SETPC (fault_PC + STR_GETDPC (R[0]));               /* reset PC */
@@ -1040,6 +1148,19 @@ else {
     R[1] = opnd[2];                                     /* src addr */
     PSL = PSL | PSL_FPD;
     }
+while (R[0] & STR_LNMASK) {                             /* page runs */
+    if ((sp = MapBlk (R[1], RA, FALSE, &run)) == NULL)
+        break;
+    n = STR_MIN (run, R[0] & STR_LNMASK);
+    if (skpc)                                           /* skip matches */
+        for (i = 0; (i < n) && (sp[i] == match); i++) ;
+    else i = ((mp = (uint8 *) memchr (sp, match, n)) != NULL)? (int32) (mp - sp): n;
+    R[0] = (R[0] & ~STR_LNMASK) | ((R[0] - i) & STR_LNMASK);
+    R[1] = R[1] + i;
+    sim_interval = sim_interval - i;
+    if (i < n)                                          /* found? */
+        break;
+    }
 for ( ; (R[0] & STR_LNMASK) != 0; sim_interval-- ) {    /* loop thru string */
     c = Read (R[1], L_BYTE, RA);                        /* get src byte */
     if ((c == match) ^ skpc)                            /* match & locc? */
@@ -1069,6 +1190,8 @@ return (R[0]? 0: CC_Z);                                 /* set cc's */
 int32 op_scnspn (int32 *opnd, int32 spanc, int32 acc)
 {
 int32 c, t, mask;
+int32 i, n, run, trun;
+uint8 *sp, *tp;
 
 if (PSL & PSL_FPD) {                                    /* FPD set? */
     SETPC (fault_PC + STR_GETDPC (R[0]));               /* reset PC */
@@ -1081,6 +1204,20 @@ else {
     R[0] = STR_PACK (mask, opnd[0]);                    /* srclen + FPD data */
     PSL = PSL | PSL_FPD;
     }
+while (R[0] & STR_LNMASK) {                             /* page runs */
+    if ((VA_GETOFF (R[3]) > (VA_PAGSIZE - 256)) ||      /* table crosses page? */
+        ((sp = MapBlk (R[1], RA, FALSE, &run)) == NULL) ||
+        ((tp = MapBlk (R[3] + sp[0], RA, FALSE, &trun)) == NULL))
+        break;
+    tp = tp - sp[0];                                    /* table base */
+    n = STR_MIN (run, R[0] & STR_LNMASK);
+    for (i = 0; (i < n) && (((tp[sp[i]] & mask) != 0) == spanc); i++) ;
+    R[0] = (R[0] & ~STR_LNMASK) | ((R[0] - i) & STR_LNMASK);
+    R[1] = R[1] + i;
+    sim_interval = sim_interval - i;
+    if (i < n)                                          /* found? */
+        break;
+    }
 for ( ; (R[0] & STR_LNMASK) != 0; sim_interval-- ) {    /* loop thru string */
     c = Read (R[1], L_BYTE, RA);                        /* get byte */
     t = Read (R[3] + c, L_BYTE, RA);                    /* get table ent */
@@ -613,6 +613,11 @@ enum opcodes {
 #define STR_PACK(m,x)   ((((PC - fault_PC) & STR_M_DPC) << STR_V_DPC) | \
                     (((m) & STR_M_CHR) << STR_V_CHR) | ((x) & STR_LNMASK))
 
+/* CPU unit flags shared with the MMU and FPA */
+
+#define UNIT_V_NOFAST   (UNIT_V_UF + 2)                 /* reference paths only */
+#define UNIT_NOFAST     (1u << UNIT_V_NOFAST)
+
 /* Read and write */
 
 #define RA              (acc)
@@ -58,6 +58,8 @@
 
 #include "vax_defs.h"
 #include <setjmp.h>
+#include <float.h>
+#include <math.h>
 
 extern int32 R[16];
 extern int32 PSL;
@@ -620,6 +622,219 @@ if (r->exp <= 0) {                                      /* underflow? */
 return r->sign | (r->exp << G_V_EXP) | UF_GETGHI (r->frac);
 }
 
+/* Host floating point fast paths
+
+   For F and G formats, add, subtract, multiply and divide are first
+   tried in host IEEE double precision.  The software routines above
+   always deliver the exact result rounded half away from zero (their
+   truncation happens only below the rounding bit), so the host path
+   computes the round to nearest double result s plus, for add and
+   multiply, its exact error e (TwoSum, TwoProduct).  From s and e the
+   VAX rounding is reproduced exactly:
+
+   F    24b fraction; s is rounded again at 24b.  Only a double result
+        exactly on a 24b tie is ambiguous, and the sign of e decides.
+        Multiply is exact in double; a quotient can never lie on or
+        within 2**-49 of a 24b tie, so division needs no error term.
+   G    53b fraction, same as double; only an exact tie (e is half the
+        gap to the neighbor) differs from round to nearest.  Division
+        results can never be ties.
+
+   Operands that are reserved or out of the band where these identities
+   hold (G exponents near the ends, where double intermediates could
+   underflow or overflow), and results that would overflow or underflow,
+   return FALSE and the caller takes the software path, which also
+   handles the faults.  Only an add can cancel to an exact zero; a zero
+   product or quotient of nonzero operands is an underflow.  D format has
+   a 56b fraction and always uses the software path.
+
+   The fast paths need IEEE double evaluated without excess precision;
+   define VAX_NO_HOST_FP to compile them out, or SET CPU NOFAST to
+   bypass them at run time.
+*/
+
+#if !defined (VAX_NO_HOST_FP) && defined (FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0) && (DBL_MANT_DIG == 53)
+#define VAX_HOST_FP     1
+
+typedef union {
+    double              d;
+    t_uint64            u;
+    } HFP;
+
+#define HFP_ADD         0
+#define HFP_MUL         1
+#define HFP_DIV         2
+#define HFP_SIGN        0x8000000000000000
+#define HFP_V_EXP       52
+#define HFP_M_EXP       0x7FF
+#define HFP_GETEXP(x)   ((int32) (((x) >> HFP_V_EXP) & HFP_M_EXP))
+#define HFP_F_BIAS      (1023 - (FD_BIAS + 1))          /* F exp to IEEE exp */
+#define HFP_F_V_LO      (HFP_V_EXP - 23)                /* F frac pos in IEEE */
+#define HFP_F_RND       (((t_uint64) 1) << (HFP_F_V_LO - 1))
+#define HFP_F_MASK      ((((t_uint64) 1) << HFP_F_V_LO) - 1)
+#define HFP_G_BIAS      ((G_BIAS + 1) - 1023)           /* G exp - IEEE exp */
+#define HFP_G_MIN       0x080                           /* IEEE exp band for G */
+#define HFP_G_MAX       0x780
+
+/* Exact error of a rounded add or multiply */
+
+static SIM_INLINE double hfp_sumerr (double x, double y, double s)
+{
+double bb = s - x;
+
+return (x - (s - bb)) + (y - bb);
+}
+
+static SIM_INLINE double hfp_mulerr (double x, double y, double p)
+{
+#if defined (FP_FAST_FMA)
+return fma (x, y, -p);
+#else
+double c, xh, xl, yh, yl;
+
+c = 134217729.0 * x;                                    /* 2**27 + 1 */
+xh = c - (c - x);
+xl = x - xh;
+c = 134217729.0 * y;
+yh = c - (c - y);
+yl = y - yh;
+return (((xh * yh - p) + xh * yl) + xl * yh) + xl * yl;
+#endif
+}
+
+/* F format - returns FALSE if the software path is needed */
+
+static t_bool hfp_getf (int32 val, double *d)
+{
+HFP t;
+int32 exp = FD_GETEXP (val);
+
+if (exp == 0) {                                         /* zero or rsvd? */
+    *d = 0.0;
+    return ((val & FPSIGN) == 0);
+    }
+t.u = (((t_uint64) (val & FPSIGN)) << 48) |
+    (((t_uint64) (exp + HFP_F_BIAS)) << HFP_V_EXP) |
+    (((t_uint64) (((val & FD_FRACW) << 16) | ((val >> 16) & 0xFFFF))) << HFP_F_V_LO);
+*d = t.d;
+return TRUE;
+}
+
+static t_bool hfp_opf (int32 op, int32 *opnd, t_bool sub, int32 *res)
+{
+double a, b, s, e;
+HFP t;
+t_uint64 mag;
+int32 exp, frac;
+
+if (!hfp_getf (opnd[0], &a) || !hfp_getf (opnd[1], &b))
+    return FALSE;
+e = 0.0;
+switch (op) {
+    case HFP_ADD:
+        if (sub)
+            a = -a;
+        s = b + a;
+        e = hfp_sumerr (b, a, s);
+        break;
+    case HFP_MUL:                                       /* exact */
+        s = b * a;
+        break;
+    default:
+        if (a == 0.0)                                   /* div by zero? */
+            return FALSE;
+        s = b / a;
+        break;
+        }
+if (s == 0.0) {                                         /* zero result? */
+    if ((op != HFP_ADD) && (a != 0.0) && (b != 0.0))    /* mul/div unflo? */
+        return FALSE;
+    *res = 0;
+    return TRUE;
+    }
+t.d = s;
+mag = t.u & ~HFP_SIGN;
+if (((mag & HFP_F_MASK) == HFP_F_RND) &&                /* on 24b tie and */
+    (e != 0.0) && ((e < 0.0) != (s < 0.0)))             /* exact is below? */
+    mag = mag & ~HFP_F_MASK;                            /* round down */
+else mag = (mag + HFP_F_RND) & ~HFP_F_MASK;             /* round half up */
+exp = HFP_GETEXP (mag) - HFP_F_BIAS;
+if ((exp <= 0) || (exp > FD_M_EXP))                     /* ovflo, unflo? */
+    return FALSE;
+frac = (int32) (mag >> HFP_F_V_LO) & 0x7FFFFF;
+*res = ((t.u & HFP_SIGN)? FPSIGN: 0) | (exp << FD_V_EXP) |
+    ((frac >> 16) & FD_FRACW) | ((frac & 0xFFFF) << 16);
+return TRUE;
+}
+
+/* G format - returns FALSE if the software path is needed */
+
+static t_bool hfp_getg (int32 hi, int32 lo, double *d)
+{
+HFP t;
+int32 exp = G_GETEXP (hi);
+
+if (exp == 0) {                                         /* zero or rsvd? */
+    *d = 0.0;
+    return ((hi & FPSIGN) == 0);
+    }
+exp = exp - HFP_G_BIAS;                                 /* IEEE exponent */
+if ((exp < HFP_G_MIN) || (exp > HFP_G_MAX))             /* out of band? */
+    return FALSE;
+t.u = UNSCRAM (hi, lo) - (((t_uint64) HFP_G_BIAS) << HFP_V_EXP);
+*d = t.d;
+return TRUE;
+}
+
+static t_bool hfp_opg (int32 op, int32 *opnd, t_bool sub, int32 *res, int32 *rh)
+{
+double a, b, s, e;
+HFP t, n;
+int32 exp;
+
+if (!hfp_getg (opnd[0], opnd[1], &a) || !hfp_getg (opnd[2], opnd[3], &b))
+    return FALSE;
+e = 0.0;
+switch (op) {
+    case HFP_ADD:
+        if (sub)
+            a = -a;
+        s = b + a;
+        e = hfp_sumerr (b, a, s);
+        break;
+    case HFP_MUL:
+        s = b * a;
+        e = hfp_mulerr (b, a, s);
+        break;
+    default:
+        if (a == 0.0)                                   /* div by zero? */
+            return FALSE;
+        s = b / a;                                      /* never a tie */
+        break;
+        }
+if (s == 0.0) {                                         /* zero result? */
+    if ((op != HFP_ADD) && (a != 0.0) && (b != 0.0))    /* mul/div unflo? */
+        return FALSE;
+    *res = *rh = 0;
+    return TRUE;
+    }
+t.d = s;
+exp = HFP_GETEXP (t.u);
+if ((exp < HFP_G_MIN) || (exp > HFP_G_MAX))             /* out of band? */
+    return FALSE;
+if ((e != 0.0) && ((e < 0.0) == (s < 0.0))) {           /* exact is above? */
+    n.u = t.u + 1;                                      /* next magnitude */
+    if ((n.d - s) == (e + e))                           /* exact is a tie? */
+        t.u = n.u;                                      /* round half up */
+    }
+t.u = t.u + (((t_uint64) HFP_G_BIAS) << HFP_V_EXP);     /* VAX exponent */
+*res = (int32) (((t.u >> 48) & 0xFFFF) | (((t.u >> 32) & 0xFFFF) << 16));
+*rh = (int32) (((t.u >> 16) & 0xFFFF) | ((t.u & 0xFFFF) << 16));
+return TRUE;
+}
+
+#endif
+
 #else                                                   /* 32b code */
 
 #define WORDSWAP(x)     ((((x) & WMASK) << 16) | (((x) >> 16) & WMASK))
@@ -1397,6 +1612,14 @@ int32 op_addf (int32 *opnd, t_bool sub)
 {
 UFP a, b;
 
+#if defined (VAX_HOST_FP)
+int32 res;
+
+if (((cpu_unit.flags & UNIT_NOFAST) == 0) &&            /* host fast path */
+    hfp_opf (HFP_ADD, opnd, sub, &res))
+    return res;
+#endif
+
 unpackf (opnd[0], &a);                                  /* F format */
 unpackf (opnd[1], &b);
 if (sub)                                                /* sub? -s1 */
@@ -1421,6 +1644,14 @@ int32 op_addg (int32 *opnd, int32 *rh, t_bool sub)
 {
 UFP a, b;
 
+#if defined (VAX_HOST_FP)
+int32 res;
+
+if (((cpu_unit.flags & UNIT_NOFAST) == 0) &&            /* host fast path */
+    hfp_opg (HFP_ADD, opnd, sub, &res, rh))
+    return res;
+#endif
+
 unpackg (opnd[0], opnd[1], &a);
 unpackg (opnd[2], opnd[3], &b);
 if (sub)                                                /* sub? -s1 */
@@ -1434,6 +1665,14 @@ return rpackg (&a, rh);                                 /* round and pack */
 int32 op_mulf (int32 *opnd)
 {
 UFP a, b;
+
+#if defined (VAX_HOST_FP)
+int32 res;
+
+if (((cpu_unit.flags & UNIT_NOFAST) == 0) &&            /* host fast path */
+    hfp_opf (HFP_MUL, opnd, FALSE, &res))
+    return res;
+#endif
     
 unpackf (opnd[0], &a);                                  /* F format */
 unpackf (opnd[1], &b);
@@ -1455,6 +1694,14 @@ int32 op_mulg (int32 *opnd, int32 *rh)
 {
 UFP a, b;
 
+#if defined (VAX_HOST_FP)
+int32 res;
+
+if (((cpu_unit.flags & UNIT_NOFAST) == 0) &&            /* host fast path */
+    hfp_opg (HFP_MUL, opnd, FALSE, &res, rh))
+    return res;
+#endif
+
 unpackg (opnd[0], opnd[1], &a);                         /* G format */
 unpackg (opnd[2], opnd[3], &b);
 vax_fmul (&a, &b, 1, G_BIAS, 0, 0);                     /* do multiply */
@@ -1467,6 +1714,14 @@ int32 op_divf (int32 *opnd)
 {
 UFP a, b;
 
+#if defined (VAX_HOST_FP)
+int32 res;
+
+if (((cpu_unit.flags & UNIT_NOFAST) == 0) &&            /* host fast path */
+    hfp_opf (HFP_DIV, opnd, FALSE, &res))
+    return res;
+#endif
+
 unpackf (opnd[0], &a);                                  /* F format */
 unpackf (opnd[1], &b);
 vax_fdiv (&a, &b, 26, FD_BIAS);                         /* do divide */
@@ -1487,6 +1742,14 @@ int32 op_divg (int32 *opnd, int32 *rh)
 {
 UFP a, b;
 
+#if defined (VAX_HOST_FP)
+int32 res;
+
+if (((cpu_unit.flags & UNIT_NOFAST) == 0) &&            /* host fast path */
+    hfp_opg (HFP_DIV, opnd, FALSE, &res, rh))
+    return res;
+#endif
+
 unpackg (opnd[0], opnd[1], &a);                         /* G format */
 unpackg (opnd[2], opnd[3], &b);
 vax_fdiv (&a, &b, 55, G_BIAS);                          /* do divide */
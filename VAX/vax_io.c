@@ -105,7 +105,10 @@
 
 #define QB_VEC_MASK     0x1FC                           /* Interrupt Vector value mask */
 
+#define MAP_BY_RUNS     (sim_end && !(cpu_unit.flags & UNIT_NOFAST))
+
 int32 int_req[IPL_HLVL] = { 0 };                        /* intr, IPL 14-17 */
+int32 int_summ = 0;                                     /* levels with int_req */
 int32 int_vec_set[IPL_HLVL][32] = { 0 };                /* bits to set in vector */
 int32 cq_scr = 0;                                       /* SCR */
 int32 cq_dser = 0;                                      /* DSER */
@@ -373,7 +376,11 @@ SET_IRQL;
 return;
 }
 
-/* Find highest priority outstanding interrupt */
+/* Find highest priority outstanding interrupt
+
+   Hardware requests are found from int_summ, the per-level summary of
+   int_req, rather than by scanning int_req.
+*/
 
 int32 eval_int (void)
 {
@@ -386,6 +393,10 @@ static const int32 sw_int_mask[IPL_SMAX] = {
     0xFE00, 0xFC00, 0xF800, 0xF000,                     /* 8 - B */
     0xE000, 0xC000, 0x8000                              /* C - E */
     };
+static const int32 hw_int_top[1u << IPL_HLVL] = {
+    0, 0, 1, 1, 2, 2, 2, 2,                             /* highest level */
+    3, 3, 3, 3, 3, 3, 3, 3                              /* in summary */
+    };
 
 if (hlt_pin)                                            /* hlt pin int */
     return IPL_HLTPIN;
@@ -393,12 +404,13 @@ if ((ipl < IPL_MEMERR) && mem_err)                      /* mem err int */
     return IPL_MEMERR;
 if ((ipl < IPL_CRDERR) && crd_err)                      /* crd err int */
     return IPL_CRDERR;
-for (i = IPL_HMAX; i >= IPL_HMIN; i--) {                /* chk hwre int */
-    if (i <= ipl)                                       /* at ipl? no int */
-        return 0;
-    if (int_req[i - IPL_HMIN])                          /* req != 0? int */
-        return i;
-    }
+if (ipl >= IPL_HMAX)                                    /* at hw max? no int */
+    return 0;
+t = int_summ;                                           /* hwre levels */
+if (ipl >= IPL_HMIN)                                    /* above ipl only */
+    t = t & ~((2u << (ipl - IPL_HMIN)) - 1);
+if (t)                                                  /* req != 0? int */
+    return IPL_HMIN + hw_int_top[t];
 if (ipl >= IPL_SMAX)                                    /* ipl >= sw max? */
     return 0;
 if ((t = SISR & sw_int_mask[ipl]) == 0)                 /* eligible req */
@@ -433,6 +445,8 @@ for (i = 0; int_req[l] && (i < 32); i++) {
         int32 vec;
 
         int_req[l] = int_req[l] & ~(1u << i);
+        if (int_req[l] == 0)                            /* level now idle? */
+            int_summ = int_summ & ~(1u << l);
         if (int_ack[l][i])
             vec = int_ack[l][i]();
         else
@@ -723,15 +737,69 @@ cq_scr = (cq_scr & CQSCR_BHL) | CQSCR_POK;
 cq_dser = cq_mear = cq_sear = cq_ipc = 0;
 for (i = 0; i < IPL_HLVL; i++)
     int_req[i] = 0;
+int_summ = 0;
 return SCPE_OK;
 }
 
+/* Map a run of Qbus addresses to host memory
+
+   Returns a pointer to the host byte for Qbus address ba, and sets
+   *run to the number of bytes, at most bc, from there to the end of
+   the Qbus page.  Returns NULL, with the map error recorded, if the
+   page is invalid or maps nonexistent memory, and also if the host is
+   big-endian (M[] is then not in bus byte order) or SET CPU NOFAST has
+   selected the reference paths.
+
+   A DMA device can use this to move data directly between memory and
+   its own buffers, one run at a time, without an intermediate copy.
+   The Map_ routines below are built on it.
+*/
+
+uint8 *Map_Run (uint32 ba, int32 bc, int32 *run)
+{
+uint32 ma, n;
+
+if (!MAP_BY_RUNS || !qba_map_addr (ba, &ma))            /* not bytes, inv? */
+    return NULL;
+n = VA_PAGSIZE - VA_GETOFF (ba);                        /* rest of page */
+if (n > (uint32) bc)
+    n = (uint32) bc;
+if (!ADDR_IS_MEM (ma + n - 1))                          /* clip at mem end */
+    n = MEMSIZE - ma;
+*run = (int32) n;
+return ((uint8 *) M) + ma;
+}
+
+/* Copy between a buffer and memory by runs - little-endian hosts only */
+
+static int32 Map_Copy (uint32 ba, int32 bc, uint8 *buf, t_bool rd)
+{
+uint8 *mp;
+int32 n;
+
+while (bc > 0) {
+    if ((mp = Map_Run (ba, bc, &n)) == NULL)            /* inv or NXM? */
+        return bc;
+    if (rd)
+        memcpy (buf, mp, n);
+    else memcpy (mp, buf, n);
+    buf = buf + n;
+    ba = ba + n;
+    bc = bc - n;
+    }
+return 0;
+}
+
 /* Qbus I/O buffer routines, aligned access
 
    Map_ReadB    -       fetch byte buffer from memory
    Map_ReadW    -       fetch word buffer from memory
    Map_WriteB   -       store byte buffer into memory
    Map_WriteW   -       store word buffer into memory
+
+   On little-endian hosts, memory transfers are done a Qbus page at a
+   time with memcpy (see Map_Run).  On big-endian hosts, they are done
+   a longword, word or byte at a time.
 */
 
 int32 Map_ReadB (uint32 ba, int32 bc, uint8 *buf)
@@ -739,6 +807,8 @@ int32 Map_ReadB (uint32 ba, int32 bc, uint8 *buf)
 int32 i;
 uint32 ma, dat;
 
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba, bc, buf, TRUE);
 if ((ba | bc) & 03) {                                   /* check alignment */
     for (i = ma = 0; i < bc; i++, buf++) {              /* by bytes */
         if ((ma & VA_M_OFF) == 0) {                     /* need map? */
@@ -773,6 +843,8 @@ uint32 ma,dat;
 
 ba = ba & ~01;
 bc = bc & ~01;
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba, bc, (uint8 *) buf, TRUE);
 if ((ba | bc) & 03) {                                   /* check alignment */
     for (i = ma = 0; i < bc; i = i + 2, buf++) {        /* by words */
         if ((ma & VA_M_OFF) == 0) {                     /* need map? */
@@ -803,6 +875,8 @@ int32 Map_WriteB (uint32 ba, int32 bc, uint8 *buf)
 int32 i;
 uint32 ma, dat;
 
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba, bc, buf, FALSE);
 if ((ba | bc) & 03) {                                   /* check alignment */
     for (i = ma = 0; i < bc; i++, buf++) {              /* by bytes */
         if ((ma & VA_M_OFF) == 0) {                     /* need map? */
@@ -837,6 +911,8 @@ uint32 ma, dat;
 
 ba = ba & ~01;
 bc = bc & ~01;
+if (MAP_BY_RUNS)                                        /* by runs? */
+    return Map_Copy (ba, bc, (uint8 *) buf, FALSE);
 if ((ba | bc) & 03) {                                   /* check alignment */
     for (i = ma = 0; i < bc; i = i + 2, buf++) {        /* by words */
         if ((ma & VA_M_OFF) == 0) {                     /* need map? */
@@ -892,7 +968,11 @@ if (qba_map_addr_c (qa, &pa) && ADDR_IS_MEM (pa)) {
 return SCPE_NXM;
 }
 
-/* Build dib_tab from device list */
+/* Build dib_tab from device list
+
+   Also rebuilds the interrupt summary, since int_req may have been changed
+   from the console (deposit, restore) while the simulator was stopped.
+*/
 
 t_stat build_dib_tab (void)
 {
@@ -901,6 +981,11 @@ DEVICE *dptr;
 DIB *dibp;
 t_stat r;
 
+int_summ = 0;                                           /* rebuild int summary */
+for (i = 0; i < IPL_HLVL; i++) {
+    if (int_req[i])
+        int_summ = int_summ | (1u << i);
+    }
 init_ubus_tab ();                                       /* init bus tables */
 for (i = 0; (dptr = sim_devices[i]) != NULL; i++) {     /* loop thru dev */
     dibp = (DIB *) dptr->ctxt;                          /* get DIB */
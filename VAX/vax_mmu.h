@@ -42,6 +42,7 @@
         ReadB(W)        -       read aligned physical byte (word)
         WriteB(W)       -       write aligned physical byte (word)
         Test            -       test acccess
+        MapBlk          -       map a page run for block string operations
 
 */
 
@@ -253,6 +254,55 @@ if (mapen) {                                            /* mapping on? */
 return va & PAMASK;                                     /* ret phys addr */
 }
 
+/* Map a page run for block string operations
+
+   Inputs:
+        va      =       virtual address
+        acc     =       access code (RA or WA)
+        back    =       TRUE if the operation runs toward lower addresses
+        run     =       pointer to returned run length
+   Output:
+        host pointer to the byte at va, or NULL if the access would
+        fault, the page is not in memory, the host is not little
+        endian, or fast paths are off
+
+   The translation is done as a byte Read or Write at va would do it,
+   except that a fault is not taken here; the caller stops its runs and
+   the original loop makes the reference and takes the fault, with the
+   same registers and at the same address as it would have without the
+   runs.  *run is the number of bytes from va to the end (or, going
+   back, the start) of its page, all of which share the translation.
+*/
+
+static SIM_INLINE uint8 *MapBlk (uint32 va, int32 acc, t_bool back, int32 *run)
+{
+int32 vpn, off, tbi, pa, stat;
+TLBENT xpte;
+
+if (!sim_end || (cpu_unit.flags & UNIT_NOFAST))        /* M[] not bytes? */
+    return NULL;
+mchk_va = va;
+off = VA_GETOFF (va);
+if (mapen) {                                            /* mapping on? */
+    vpn = VA_GETVPN (va);
+    tbi = VA_GETTBI (vpn);
+    xpte = (va & VA_S0)? stlb[tbi]: ptlb[tbi];          /* access tlb */
+    if (((xpte.pte & acc) == 0) || (xpte.tag != vpn) ||
+        ((acc & TLB_WACC) && ((xpte.pte & TLB_M) == 0))) {
+        stat = PR_OK;                                   /* assume ok */
+        xpte = fill (va, L_BYTE, acc, &stat);           /* fill if needed */
+        if (stat != PR_OK)                              /* would fault? */
+            return NULL;
+        }
+    pa = (xpte.pte & TLB_PFN) | off;
+    }
+else pa = va & PAMASK;
+if (!ADDR_IS_MEM (pa) || !ADDR_IS_MEM (pa | VA_M_OFF))  /* page in memory? */
+    return NULL;
+*run = back? off + 1: VA_PAGSIZE - off;
+return ((uint8 *) M) + pa;
+}
+
 /* Read aligned physical (in virtual context, unless indicated)
 
    Inputs:
@@ -424,12 +424,21 @@ typedef struct {
 #define VEC_QBUS        1                               /* Qbus system */
 #define VEC_SET         0x201                           /* Vector bits to set in Qbus vectors */
 
-/* Interrupt macros */
+/* Interrupt macros
+
+   int_summ has one bit per level of int_req, set when that level has any
+   request pending.  SET_INT and CLR_INT keep it current; code that writes
+   int_req directly must update it as well.
+*/
+
+extern int32 int_summ;
 
 #define IVCL(dv)        ((IPL_##dv * 32) + INT_V_##dv)
 #define IREQ(dv)        int_req[IPL_##dv]
-#define SET_INT(dv)     int_req[IPL_##dv] = int_req[IPL_##dv] | (INT_##dv)
-#define CLR_INT(dv)     int_req[IPL_##dv] = int_req[IPL_##dv] & ~(INT_##dv)
+#define SET_INT(dv)     (int_req[IPL_##dv] = int_req[IPL_##dv] | (INT_##dv), \
+                         int_summ = int_summ | (1u << IPL_##dv))
+#define CLR_INT(dv)     (int_req[IPL_##dv] = int_req[IPL_##dv] & ~(INT_##dv), \
+                         int_summ = int_summ & ~((int_req[IPL_##dv] == 0) << IPL_##dv))
 #define IORETURN(f,v)   ((f)? (v): SCPE_OK)             /* cond error return */
 
 /* Logging */
@@ -444,6 +453,7 @@ int32 Map_ReadB (uint32 ba, int32 bc, uint8 *buf);
 int32 Map_ReadW (uint32 ba, int32 bc, uint16 *buf);
 int32 Map_WriteB (uint32 ba, int32 bc, uint8 *buf);
 int32 Map_WriteW (uint32 ba, int32 bc, uint16 *buf);
+uint8 *Map_Run (uint32 ba, int32 bc, int32 *run);
 
 #include "pdp11_io_lib.h"
 
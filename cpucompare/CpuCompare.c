@@ -0,0 +1,556 @@
+/* CpuCompare.c: differential check of simulator CPU configurations
+
+   Permission is hereby granted, free of charge, to any person obtaining a
+   copy of this software and associated documentation files (the "Software"),
+   to deal in the Software without restriction, including without limitation
+   the rights to use, copy, modify, merge, publish, distribute, sublicense,
+   and/or sell copies of the Software, and to permit persons to whom the
+   Software is furnished to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+   IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+   FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL
+   THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+   CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+   This program runs one command file through two configurations of the
+   same simulator binary and compares everything the two runs print.  The
+   configurations differ only in the CPU modifier passed to the command
+   file as %1, by default FAST (the optimized paths) and NOFAST (the
+   reference routines), so any difference in register, PSL/PSW or memory
+   contents that the file examines is a bug in an optimized path.
+
+   With no command file, a random one is generated.  Each step of it loads
+   random registers and a random instruction, executes it with STEP and
+   examines the registers, PSL/PSW, a data window and the stack.  All
+   register operands point into the data window half of the time, so
+   memory references are examined as well.  At the end all of low memory
+   is compared.  Generators exist for the PDP-11 and the VAX; the
+   simulator is recognized by its name.
+
+   Usage: cpucompare {-n steps} {-s seed} {-a mod} {-b mod} {-k}
+                     simulator {command-file {args}}
+
+        -n steps    number of random steps, or %3 for a command file
+        -s seed     random seed, or %2 for a command file
+        -a mod      first CPU modifier, default FAST
+        -b mod      second CPU modifier, default NOFAST
+        -k          keep the generated command file and the run logs
+
+   A command file is run as "simulator command-file mod seed steps args".
+   The exit status is 0 when the runs agree and 1 when they differ.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAXLINE         1024
+
+#if defined (_WIN32)
+#define NULL_DEVICE     "NUL"
+#else
+#define NULL_DEVICE     "/dev/null"
+#endif
+
+#define SIM_PDP11       0
+#define SIM_VAX         1
+
+static unsigned int rnd_state = 1;
+
+/* Random number generator (xorshift) */
+
+static unsigned int rnd (void)
+{
+unsigned int x = rnd_state;
+
+x = x ^ (x << 13);
+x = x ^ (x >> 17);
+x = x ^ (x << 5);
+rnd_state = x & 0xFFFFFFFF;
+return rnd_state;
+}
+
+/* PDP-11 step
+
+   Registers R0-R5 hold a data window pointer or a random word.  Half of
+   the steps run with memory management on, kernel page 0 relocated to
+   one of four physical pages and page 7 mapped to the I/O page; code,
+   data window and stack are all in page 0 and are loaded and examined
+   through the mapping.  The instruction is a random word, biased towards
+   register modes on R0-R5, followed by two random words.
+*/
+
+static int pdp11_spec (void)
+{
+int mode = rnd () & 07;
+int reg = rnd () & 07;
+
+if (reg > 5)                                            /* mostly R0-R5 */
+    reg = rnd () & 07;
+return (mode << 3) | reg;
+}
+
+static void pdp11_init (FILE *f)
+{
+int i;
+
+for (i = 0; i < 0200; i = i + 2)                        /* data window */
+    fprintf (f, "dep %o %o\n", 02000 + i, rnd () & 0177777);
+}
+
+static void pdp11_step (FILE *f)
+{
+int i, inst;
+
+for (i = 0; i < 6; i++)
+    fprintf (f, "dep r%d %o\n", i, (rnd () & 1)?
+        (02000 + (rnd () & 0176)): (rnd () & 0177777));
+fprintf (f, "dep sp 7000\n");
+fprintf (f, "dep psw %o\n", 0340 | (rnd () & 017));
+if (rnd () & 1) {                                       /* mapped? */
+    fprintf (f, "dep kipar0 %o\n", (rnd () & 3) * 0200);
+    fprintf (f, "dep kipdr0 77406\n");
+    fprintf (f, "dep kipar7 177600\n");
+    fprintf (f, "dep kipdr7 77406\n");
+    fprintf (f, "dep mmr0 1\n");
+    }
+else fprintf (f, "dep mmr0 0\n");
+if (rnd () & 1)
+    inst = (rnd () & 0170000) | (pdp11_spec () << 6) | pdp11_spec ();
+else inst = rnd () & 0177777;
+fprintf (f, "dep -v 1000 %o\n", inst);
+fprintf (f, "dep -v 1002 %o\n", rnd () & 0177777);
+fprintf (f, "dep -v 1004 %o\n", rnd () & 0177777);
+fprintf (f, "dep pc 1000\n");
+fprintf (f, "step\n");
+fprintf (f, "ex r0-r5\n");
+fprintf (f, "ex sp,pc,psw,mmr0\n");
+fprintf (f, "ex -v 2000:2176\n");
+fprintf (f, "ex -v 6760:6776\n");
+}
+
+static void pdp11_done (FILE *f)
+{
+fprintf (f, "ex 0:177776\n");
+}
+
+/* VAX step
+
+   Registers hold a data window pointer or a random longword, and the
+   PSL gets random condition codes and DV/FU/IV bits at IPL 31.  Half of
+   the instructions are F, D or G floating arithmetic on R0-R5, whose
+   operands are the random register contents; the rest are a random
+   opcode followed by operand specifiers on R0-R5 (literal, register,
+   deferred, autoincrement, autodecrement, byte displacement).
+
+   The packed decimal and string instructions that a MicroVAX emulates
+   through the SCB push their unused operand slots with whatever the host
+   left there, so the frame differs from run to run.  MFPR can read the
+   time of year and interval clocks.  Neither is generated.
+
+   Every SCB vector leads to a HALT, so an exception ends the step instead
+   of looping through a fault that recurs before the instruction counts.
+
+   A quarter of the steps run a character string instruction (MOVC3,
+   MOVC5, CMPC3, CMPC5, LOCC, SKPC, SCANC, SPANC) with memory management
+   on.  P0 space maps the low 32KB one to one through a page table that
+   is itself in system space, and the eight pages of the string area at
+   5000-5FFF are each made valid, read only or invalid at random.  The
+   step invalidates the TLB with MTPR, then runs the string instruction
+   on operands of up to 5FF bytes in the string area, so its page runs
+   need TLB fills and can fault part way through.  All string pages are
+   then made valid and the instruction is restarted with FPD set, as REI
+   would resume it.  The string area PTEs, whose M bits the writes set,
+   and the destination of a move are examined after both halves.
+*/
+
+static const int vax_fp_ops[] = {
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47,     /* F */
+    0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67,     /* D */
+    0xFD40, 0xFD41, 0xFD42, 0xFD43,                     /* G */
+    0xFD44, 0xFD45, 0xFD46, 0xFD47,
+    0x51, 0x71, 0xFD51                                  /* CMPx */
+    };
+
+static const int vax_str_ops[] = {
+    0x28, 0x2C, 0x29, 0x2D,                             /* MOVCx, CMPCx */
+    0x3A, 0x3B,                                         /* LOCC, SKPC */
+    0x2A, 0x2B                                          /* SCANC, SPANC */
+    };
+
+#define VAX_P0PT        0xC000                          /* P0 page table */
+#define VAX_STR         0x5000                          /* string area */
+#define VAX_STR_PG      8                               /* string area pages */
+
+static int vax_unrepeatable (int op)
+{
+return (op == 0x08) || (op == 0x09) || (op == 0x0B) ||
+    ((op >= 0x20) && (op <= 0x27)) || (op == 0x2E) || (op == 0x2F) ||
+    ((op >= 0x34) && (op <= 0x39)) || (op == 0xF8) || (op == 0xF9) ||
+    (op == 0xDB);                                       /* MFPR */
+}
+
+static void vax_init (FILE *f)
+{
+int i;
+
+for (i = 0; i < 0x100; i = i + 4)                       /* data window */
+    fprintf (f, "dep -l %X %X\n", 0x2000 + i, rnd ());
+for (i = 0; i < 0x200; i = i + 4)                       /* SCB to HALT */
+    fprintf (f, "dep -l %X 3000\n", 0x4000 + i);
+fprintf (f, "dep -l 3000 0\n");
+for (i = 0; i < 0x1000; i = i + 4)                      /* string area */
+    fprintf (f, "dep -l %X %X\n", VAX_STR + i,
+        (rnd () & 7)? 0x55555555: rnd ());
+for (i = 0; i < 0x40; i++)                              /* P0 = phys 0-7FFF */
+    fprintf (f, "dep -l %X %X\n", VAX_P0PT + (i * 4), 0xA4000000 | i);
+}
+
+/* Examine a mapped string step */
+
+static void vax_str_ex (FILE *f, int op, unsigned int dst, int dlnt)
+{
+fprintf (f, "ex r0-r11\n");
+fprintf (f, "ex ap,fp,sp,pc,psl\n");
+fprintf (f, "ex -l %X:%X\n", VAX_P0PT + ((VAX_STR >> 9) * 4),
+    VAX_P0PT + (((VAX_STR >> 9) + VAX_STR_PG) * 4) - 1);
+fprintf (f, "ex -l 7FC0:7FFF\n");
+if (((op == 0x28) || (op == 0x2C)) && (dlnt > 0))       /* move? */
+    fprintf (f, "ex -l %X:%X\n", dst & ~3, (dst + dlnt - 1) | 3);
+}
+
+static void vax_str_step (FILE *f)
+{
+unsigned char code[16];
+unsigned int src, dst, cc;
+int i, n, op, slnt, dlnt;
+
+op = vax_str_ops[rnd () % (sizeof (vax_str_ops) / sizeof (vax_str_ops[0]))];
+src = VAX_STR + (rnd () & 0xFFF);
+dst = VAX_STR + (rnd () & 0xFFF);
+slnt = rnd () % 0x600;
+dlnt = (op == 0x2C)? rnd () % 0x600: slnt;
+cc = rnd () & 0xEF;
+for (i = 0; i < 14; i++)
+    fprintf (f, "dep r%d %X\n", i, rnd ());
+fprintf (f, "dep r6 %X\n", slnt);                       /* length */
+fprintf (f, "dep r7 %X\n", src);                        /* source */
+fprintf (f, "dep r8 %X\n", dst);                        /* dest */
+fprintf (f, "dep r9 %X\n",                              /* fill, char, mask */
+    (rnd () & 1)? 0x55: rnd () & 0xFF);
+fprintf (f, "dep r10 %X\n", dlnt);                      /* dest length */
+fprintf (f, "dep r11 2000\n");                          /* table */
+fprintf (f, "dep sp 8000\n");
+fprintf (f, "dep scbb 4000\n");
+fprintf (f, "dep sbr A000\n");
+fprintf (f, "dep slr 1\n");
+fprintf (f, "dep -l A000 %X\n", 0xA0000000 | (VAX_P0PT >> 9));
+fprintf (f, "dep p0br 80000000\n");
+fprintf (f, "dep p0lr 40\n");
+for (i = 0; i < VAX_STR_PG; i++) {                      /* string area PTEs */
+    int pte = 0x24000000 | ((VAX_STR >> 9) + i);
+
+    switch (rnd () & 7) {
+        case 0: case 1:                                 /* invalid */
+            break;
+        case 2:                                         /* read only */
+            pte = (pte & ~0x78000000) | 0x98000000;
+            break;
+        default:                                        /* valid, M random */
+            pte = (pte | 0x80000000) & ((rnd () & 1)? ~0: ~0x04000000);
+            break;
+            }
+    fprintf (f, "dep -l %X %X\n", VAX_P0PT + (((VAX_STR >> 9) + i) * 4), pte);
+    }
+fprintf (f, "dep mapen 1\n");
+fprintf (f, "dep psl %X\n", 0x041F0000 | cc);
+memset (code, 0, sizeof (code));
+code[0] = 0xDA;                                         /* MTPR #0,#TBIA */
+code[1] = 0x00;
+code[2] = 0x39;
+n = 3;
+code[n++] = (unsigned char) op;
+switch (op) {
+    case 0x28: case 0x29:                               /* MOVC3, CMPC3 */
+        code[n++] = 0x56;                               /* R6 */
+        code[n++] = 0x67;                               /* (R7) */
+        code[n++] = 0x68;                               /* (R8) */
+        break;
+    case 0x2C: case 0x2D:                               /* MOVC5, CMPC5 */
+        code[n++] = 0x56;                               /* R6 */
+        code[n++] = 0x67;                               /* (R7) */
+        code[n++] = 0x59;                               /* R9 */
+        code[n++] = 0x5A;                               /* R10 */
+        code[n++] = 0x68;                               /* (R8) */
+        break;
+    case 0x3A: case 0x3B:                               /* LOCC, SKPC */
+        code[n++] = 0x59;                               /* R9 */
+        code[n++] = 0x56;                               /* R6 */
+        code[n++] = 0x67;                               /* (R7) */
+        break;
+    default:                                            /* SCANC, SPANC */
+        code[n++] = 0x56;                               /* R6 */
+        code[n++] = 0x67;                               /* (R7) */
+        code[n++] = 0x6B;                               /* (R11) */
+        code[n++] = 0x59;                               /* R9 */
+        break;
+        }
+for (i = 0; i < (int) sizeof (code); i = i + 4)
+    fprintf (f, "dep -l %X %X\n", 0x1000 + i, code[i] | (code[i + 1] << 8) |
+        (code[i + 2] << 16) | ((unsigned int) code[i + 3] << 24));
+fprintf (f, "dep pc 1000\n");
+fprintf (f, "step 2\n");
+vax_str_ex (f, op, dst, dlnt);
+for (i = 0; i < VAX_STR_PG; i++)                        /* all valid */
+    fprintf (f, "dep -l %X %X\n", VAX_P0PT + (((VAX_STR >> 9) + i) * 4),
+        0xA0000000 | ((VAX_STR >> 9) + i));
+fprintf (f, "dep sp 8000\n");
+fprintf (f, "dep psl %X\n", 0x0C1F0000 | cc);           /* restart, FPD */
+fprintf (f, "dep pc 1003\n");
+fprintf (f, "step\n");
+vax_str_ex (f, op, dst, dlnt);
+}
+
+static void vax_step (FILE *f)
+{
+unsigned char code[32];
+int i, n, op;
+
+if ((rnd () & 3) == 0) {                                /* mapped string? */
+    vax_str_step (f);
+    return;
+    }
+for (i = 0; i < 14; i++)
+    fprintf (f, "dep r%d %X\n", i, (rnd () & 1)?
+        (0x2000 + (rnd () & 0xFC)): rnd ());
+fprintf (f, "dep sp 8000\n");
+fprintf (f, "dep mapen 0\n");
+fprintf (f, "dep scbb 4000\n");
+fprintf (f, "dep psl %X\n", 0x041F0000 | (rnd () & 0xEF));
+memset (code, 0, sizeof (code));
+n = 0;
+if (rnd () & 1) {                                       /* floating? */
+    op = vax_fp_ops[rnd () % (sizeof (vax_fp_ops) / sizeof (vax_fp_ops[0]))];
+    if (op > 0xFF)
+        code[n++] = (unsigned char) (op >> 8);
+    code[n++] = (unsigned char) op;
+    code[n++] = 0x50;                                   /* R0 */
+    code[n++] = 0x52;                                   /* R2 */
+    if (op & 1)                                         /* 3 operand? */
+        code[n++] = 0x54;                               /* R4 */
+    }
+else {
+    do {
+        code[0] = (unsigned char) rnd ();
+        } while (vax_unrepeatable (code[0]));
+    n = 1;
+    if (code[0] == 0xFD)
+        code[n++] = (unsigned char) rnd ();
+    for (i = 0; i < 6; i++) {
+        int reg = rnd () % 6;
+
+        switch (rnd () & 7) {
+            case 0:                                     /* short literal */
+                code[n++] = rnd () & 0x3F;
+                break;
+            case 1: case 2:                             /* register */
+                code[n++] = 0x50 | reg;
+                break;
+            case 3:                                     /* deferred */
+                code[n++] = 0x60 | reg;
+                break;
+            case 4:                                     /* autoincrement */
+                code[n++] = 0x80 | reg;
+                break;
+            case 5:                                     /* autodecrement */
+                code[n++] = 0x70 | reg;
+                break;
+            default:                                    /* byte disp */
+                code[n++] = 0xA0 | reg;
+                code[n++] = rnd () & 0x7C;
+                break;
+                }
+        }
+    }
+for (i = 0; i < (int) sizeof (code); i = i + 4)
+    fprintf (f, "dep -l %X %X\n", 0x1000 + i, code[i] | (code[i + 1] << 8) |
+        (code[i + 2] << 16) | ((unsigned int) code[i + 3] << 24));
+fprintf (f, "dep pc 1000\n");
+fprintf (f, "step\n");
+fprintf (f, "ex r0-r11\n");
+fprintf (f, "ex ap,fp,sp,pc,psl\n");
+fprintf (f, "ex -l 2000:20FF\n");
+fprintf (f, "ex -l 7FC0:7FFF\n");
+}
+
+static void vax_done (FILE *f)
+{
+fprintf (f, "ex -l 0:FFFF\n");
+}
+
+/* Generate a random step command file */
+
+static int gen_steps (const char *path, int type, int steps, unsigned int seed)
+{
+FILE *f;
+int i;
+
+if ((f = fopen (path, "w")) == NULL) {
+    perror (path);
+    return 1;
+    }
+fprintf (f, "; cpucompare random steps, seed %u\n", seed);
+fprintf (f, "set cpu %%1\n");
+if (type == SIM_PDP11)
+    pdp11_init (f);
+else vax_init (f);
+for (i = 0; i < steps; i++) {
+    fprintf (f, "echo STEP %d\n", i);
+    if (type == SIM_PDP11)
+        pdp11_step (f);
+    else vax_step (f);
+    }
+fprintf (f, "echo DONE\n");
+if (type == SIM_PDP11)
+    pdp11_done (f);
+else vax_done (f);
+fprintf (f, "exit\n");
+fclose (f);
+return 0;
+}
+
+/* Run the simulator on a command file, console input from the null device
+   and output to a log */
+
+static int run_sim (const char *sim, const char *cmd, const char *mod,
+    unsigned int seed, int steps, const char *args, const char *log)
+{
+char buf[4 * MAXLINE];
+
+sprintf (buf, "\"%s\" \"%s\" %s %u %d %s < %s > \"%s\" 2>&1",
+    sim, cmd, mod, seed, steps, args, NULL_DEVICE, log);
+return system (buf);
+}
+
+/* Compare two logs; the last STEP line read locates a difference */
+
+static int compare_logs (const char *log_a, const char *log_b,
+    const char *mod_a, const char *mod_b)
+{
+FILE *fa, *fb;
+char la[MAXLINE], lb[MAXLINE], where[MAXLINE];
+char *ra, *rb;
+long line = 0;
+
+if (((fa = fopen (log_a, "r")) == NULL) ||
+    ((fb = fopen (log_b, "r")) == NULL)) {
+    perror ("log");
+    return 2;
+    }
+strcpy (where, "start");
+while (1) {
+    ra = fgets (la, sizeof (la), fa);
+    rb = fgets (lb, sizeof (lb), fb);
+    if ((ra == NULL) && (rb == NULL))
+        break;
+    line++;
+    if ((ra == NULL) || (rb == NULL) || strcmp (la, lb)) {
+        printf ("Difference at log line %ld, after %s:\n", line, where);
+        printf ("  %-8s %s", mod_a, ra? la: "<end of output>\n");
+        printf ("  %-8s %s", mod_b, rb? lb: "<end of output>\n");
+        fclose (fa);
+        fclose (fb);
+        return 1;
+        }
+    if (strncmp (la, "STEP ", 5) == 0) {
+        strncpy (where, la, sizeof (where) - 1);
+        where[sizeof (where) - 1] = 0;
+        where[strcspn (where, "\r\n")] = 0;
+        }
+    }
+fclose (fa);
+fclose (fb);
+printf ("No differences in %ld lines of output\n", line);
+return 0;
+}
+
+int main (int argc, char **argv)
+{
+const char *sim, *cmd, *name;
+const char *mod_a = "FAST", *mod_b = "NOFAST";
+char gen[64], log_a[64], log_b[64], args[2 * MAXLINE];
+unsigned int seed = (unsigned int) time (NULL);
+int steps = 10000, keep = 0, type, i, r;
+
+for (i = 1; (i < argc) && (argv[i][0] == '-'); i++) {
+    if (strcmp (argv[i], "-k") == 0)
+        keep = 1;
+    else if ((i + 1) < argc) {
+        if (strcmp (argv[i], "-n") == 0)
+            steps = atoi (argv[++i]);
+        else if (strcmp (argv[i], "-s") == 0)
+            seed = (unsigned int) strtoul (argv[++i], NULL, 0);
+        else if (strcmp (argv[i], "-a") == 0)
+            mod_a = argv[++i];
+        else if (strcmp (argv[i], "-b") == 0)
+            mod_b = argv[++i];
+        else break;
+        }
+    else break;
+    }
+if (i >= argc) {
+    fprintf (stderr, "Usage: %s {-n steps} {-s seed} {-a mod} {-b mod} {-k} "
+        "simulator {command-file {args}}\n", argv[0]);
+    return 2;
+    }
+sim = argv[i++];
+for (name = cmd = sim; *cmd; cmd++) {                   /* strip directory */
+    if ((*cmd == '/') || (*cmd == '\\'))
+        name = cmd + 1;
+    }
+type = strstr (name, "pdp11")? SIM_PDP11: SIM_VAX;
+args[0] = 0;
+sprintf (log_a, "cpucompare-%u-a.log", seed);
+sprintf (log_b, "cpucompare-%u-b.log", seed);
+if (i < argc) {                                         /* command file? */
+    cmd = argv[i++];
+    for ( ; i < argc; i++) {
+        if ((strlen (args) + strlen (argv[i]) + 4) >= sizeof (args))
+            break;
+        strcat (args, " \"");
+        strcat (args, argv[i]);
+        strcat (args, "\"");
+        }
+    gen[0] = 0;
+    }
+else {
+    if ((type == SIM_VAX) && (strstr (name, "vax") == NULL)) {
+        fprintf (stderr, "%s: no step generator for %s\n", argv[0], name);
+        return 2;
+        }
+    sprintf (gen, "cpucompare-%u.ini", seed);
+    rnd_state = seed? seed: 1;
+    if (gen_steps (gen, type, steps, seed))
+        return 2;
+    cmd = gen;
+    }
+printf ("%s: %s, seed %u, %d steps, %s vs %s\n", name, cmd, seed, steps,
+    mod_a, mod_b);
+fflush (stdout);
+run_sim (sim, cmd, mod_a, seed, steps, args, log_a);
+run_sim (sim, cmd, mod_b, seed, steps, args, log_b);
+r = compare_logs (log_a, log_b, mod_a, mod_b);
+if (!keep) {
+    if (gen[0])
+        remove (gen);
+    remove (log_a);
+    remove (log_b);
+    }
+return r;
+}
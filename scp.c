@@ -438,6 +438,7 @@ t_stat dep_addr (int32 flag, char *cptr, t_addr addr, DEVICE *dptr,
     UNIT *uptr, int32 dfltinc);
 void fprint_fields (FILE *stream, t_value before, t_value after, BITFIELD* bitdefs);
 t_stat step_svc (UNIT *ptr);
+t_stat benchmark_cmd (int32 flag, char *cptr);
 t_stat expect_svc (UNIT *ptr);
 t_stat shift_args (char *do_arg[], size_t arg_count);
 t_stat set_on (int32 flag, char *cptr);
@@ -450,12 +451,15 @@ t_stat do_cmd_label (int32 flag, char *cptr, char *label);
 void int_handler (int signal);
 t_stat set_prompt (int32 flag, char *cptr);
 t_stat sim_set_asynch (int32 flag, char *cptr);
+t_stat sim_set_memory (int32 flag, char *cptr);
+t_stat sim_show_memory (FILE *st, DEVICE *dptr, UNIT *uptr, int32 flag, char *cptr);
 t_stat sim_set_environment (int32 flag, char *cptr);
 static const char *get_dbg_verb (uint32 dbits, DEVICE* dptr);
 
 /* Global data */
 
 DEVICE *sim_dflt_dev = NULL;
+static double sim_events = 0;                           /* events processed */
 UNIT *sim_clock_queue = QUEUE_LIST_END;
 int32 sim_interval = 0;
 int32 sim_switches = 0;
@@ -794,6 +798,34 @@ static const char simh_help[] =
       "4Switches\n"
       " If the STEP command is invoked with the -T switch, the step command will\n"
       " cause execution to run for microseconds rather than instructions.\n"
+#define HLP_BENCHMARK   "*Commands Running_A_Simulated_Program BENCHMARK"
+      "3BENCHMARK\n"
+      " The BENCHMARK command (abbreviated BE) measures simulator performance.\n"
+      " It optionally executes a command file which sets up a workload (loads\n"
+      " a program, attaches devices, deposits a starting PC, etc.), and then\n"
+      " resumes execution at the current PC for the given number of\n"
+      " simulator cycles with idling and throttling held off:\n\n"
+      "++BENCHMARK count {file {arg1 ...}}\n\n"
+      " When execution stops, the results are displayed one per line in\n"
+      " name=value form, suitable for processing by scripts:\n\n"
+      "++benchmark.simulator       simulator name\n"
+      "++benchmark.status          reason execution stopped\n"
+      "++benchmark.cycles          simulator cycles executed\n"
+      "++benchmark.elapsed_ms      wall clock time\n"
+      "++benchmark.host_cpu_ms     host processor time\n"
+      "++benchmark.cycles_per_sec  cycle rate\n"
+      "++benchmark.events          simulator events processed\n"
+      "++benchmark.events_per_sec  event rate\n"
+      "++benchmark.io_read_bytes   container file bytes read\n"
+      "++benchmark.io_write_bytes  container file bytes written\n"
+      "++benchmark.io_read_rate    bytes read per second\n"
+      "++benchmark.io_write_rate   bytes written per second\n\n"
+      " A simulator cycle is one count of the STEP command.  Most simulators\n"
+      " charge one cycle per instruction, but some charge more for long\n"
+      " instructions, such as the VAX string instructions, so cycles are not\n"
+      " always instructions.\n\n"
+      " Example:\n\n"
+      "++BENCHMARK 100000000 cpuloop.sim\n"
 #define HLP_NEXT        "*Commands Running_A_Simulated_Program NEXT"
       "3NEXT\n"
       " The NEXT command (abbreviated N) resumes execution at the current PC for\n"
@@ -1051,10 +1083,22 @@ static const char simh_help[] =
       "+set throttle {x{M|K|%%}}|{x/t}\n"
       "++++++++                     set simulation rate\n"
       "+set nothrottle              set simulation rate to maximum\n"
+#define HLP_SET_CLOCK "*Commands SET Clock"
+      "3Clock\n"
+      "+set clock fastforward       skip guest idle time by advancing simulated\n"
+      "++++++++                     time directly to the next pending event;\n"
+      "++++++++                     only idle time the simulator detects is\n"
+      "++++++++                     skipped, so most simulators also need\n"
+      "++++++++                     SET CPU IDLE\n"
+      "+set clock nofastforward     idle by sleeping on the host (default)\n"
 #define HLP_SET_ASYNCH "*Commands SET Asynch"
       "3Asynch\n"
       "+set asynch                  enable asynchronous I/O\n"
       "+set noasynch                disable asynchronous I/O\n"
+#define HLP_SET_MEMORY "*Commands SET Memory"
+      "3Memory\n"
+      "+set memory hugepages        back simulated memory with host huge pages\n"
+      "+set memory nohugepages      use normal host pages (default)\n"
 #define HLP_SET_ENVIRON "*Commands SET Asynch"
       "3Environment\n"
       "+set environment name=val    set environment variable\n"
@@ -1122,6 +1166,7 @@ static const char simh_help[] =
       "+sh{ow} ti{me}               show simulated time\n"
       "+sh{ow} th{rottle}           show simulation rate\n"
       "+sh{ow} a{synch}             show asynchronouse I/O state\n" 
+      "+sh{ow} mem{ory}             show simulated memory allocations\n"
       "+sh{ow} ve{rsion}            show simulator version\n"
       "+sh{ow} def{ault}            show current directory\n" 
       "+sh{ow} re{mote}             show remote console configuration\n" 
@@ -1160,6 +1205,7 @@ static const char simh_help[] =
 #define HLP_SHOW_DEBUG          "*Commands SHOW"
 #define HLP_SHOW_THROTTLE       "*Commands SHOW"
 #define HLP_SHOW_ASYNCH         "*Commands SHOW"
+#define HLP_SHOW_MEMORY         "*Commands SHOW"
 #define HLP_SHOW_ETHERNET       "*Commands SHOW"
 #define HLP_SHOW_SERIAL         "*Commands SHOW"
 #define HLP_SHOW_MULTIPLEXER    "*Commands SHOW"
@@ -1713,6 +1759,7 @@ static CTAB cmd_table[] = {
     { "NEXT",       &run_cmd,       RU_NEXT,    HLP_NEXT,       NULL, &run_cmd_message },
     { "CONTINUE",   &run_cmd,       RU_CONT,    HLP_CONTINUE,   NULL, &run_cmd_message },
     { "BOOT",       &run_cmd,       RU_BOOT,    HLP_BOOT,       NULL, &run_cmd_message },
+    { "BENCHMARK",  &benchmark_cmd, 0,          HLP_BENCHMARK },
     { "BREAK",      &brk_cmd,       SSH_ST,     HLP_BREAK },
     { "NOBREAK",    &brk_cmd,       SSH_CL,     HLP_NOBREAK },
     { "ATTACH",     &attach_cmd,    0,          HLP_ATTACH },
@@ -1771,6 +1818,7 @@ static CTAB set_glob_tab[] = {
     { "NODEBUG",    &sim_set_deboff,            0, HLP_SET_DEBUG  },
     { "THROTTLE",   &sim_set_throt,             1, HLP_SET_THROTTLE },
     { "NOTHROTTLE", &sim_set_throt,             0, HLP_SET_THROTTLE },
+    { "CLOCK",      &sim_set_timers,            1, HLP_SET_CLOCK },
     { "ASYNCH",     &sim_set_asynch,            1, HLP_SET_ASYNCH },
     { "NOASYNCH",   &sim_set_asynch,            0, HLP_SET_ASYNCH },
     { "ENVIRONMENT", &sim_set_environment,      1, HLP_SET_ENVIRON },
@@ -1782,6 +1830,7 @@ static CTAB set_glob_tab[] = {
     { "NOVERBOSE",  &set_verify,                0, HLP_SET_VERIFY },
     { "MESSAGE",    &set_message,               1, HLP_SET_MESSAGE },
     { "NOMESSAGE",  &set_message,               0, HLP_SET_MESSAGE },
+    { "MEMORY",     &sim_set_memory,            0, HLP_SET_MEMORY },
     { "QUIET",      &set_quiet,                 1, HLP_SET_QUIET },
     { "NOQUIET",    &set_quiet,                 0, HLP_SET_QUIET },
     { "PROMPT",     &set_prompt,                0, HLP_SET_PROMPT },
@@ -1824,6 +1873,7 @@ static SHTAB show_glob_tab[] = {
     { "DEBUG",          &sim_show_debug,            0, HLP_SHOW_DEBUG },
     { "THROTTLE",       &sim_show_throt,            0, HLP_SHOW_THROTTLE },
     { "ASYNCH",         &sim_show_asynch,           0, HLP_SHOW_ASYNCH },
+    { "MEMORY",         &sim_show_memory,           0, HLP_SHOW_MEMORY },
     { "ETHERNET",       &eth_show_devices,          0, HLP_SHOW_ETHERNET },
     { "SERIAL",         &sim_show_serial,           0, HLP_SHOW_SERIAL },
     { "MULTIPLEXER",    &tmxr_show_open_devices,    0, HLP_SHOW_MULTIPLEXER },
@@ -6259,6 +6309,84 @@ UPDATE_SIM_TIME;                                        /* update sim time */
 return r | ((sim_switches & SWMASK ('Q')) ? SCPE_NOMESSAGE : 0);
 }
 
+/* Benchmark command
+
+   be[nchmark] count {file {args...}}
+
+   Executes the optional command file to set up a workload and then runs
+   the simulator from the current PC for 'count' cycles with idling and
+   throttling held off.  Performance figures are reported as name=value
+   lines.  Cycles are measured by sim_gtime, which advances by whatever a
+   simulator charges sim_interval, so they equal instructions only in
+   simulators that charge one cycle per instruction.
+*/
+
+t_stat benchmark_cmd (int32 flag, char *cptr)
+{
+char gbuf[CBUFSIZE];
+int32 count;
+uint32 start_ms, elapsed_ms;
+clock_t start_clock;
+double start_gtime, start_events, start_rbytes, start_wbytes;
+double cycles, events, rbytes, wbytes, secs, cpu_ms;
+const char *status;
+t_stat r;
+
+GET_SWITCHES (cptr);                                    /* get switches */
+if (*cptr == 0)                                         /* must be more */
+    return SCPE_2FARG;
+cptr = get_glyph (cptr, gbuf, 0);                       /* get count */
+count = (int32) get_uint (gbuf, 10, INT_MAX, &r);
+if ((r != SCPE_OK) || (count <= 0))
+    return SCPE_ARG;
+if (*cptr != 0) {                                       /* workload setup? */
+    if (sim_do_depth >= MAX_DO_NEST_LVL)                /* nest too deep? */
+        return SCPE_NEST;
+    r = do_cmd (sim_do_depth+1, cptr);
+    if (SCPE_BARE_STATUS(r) != SCPE_OK)
+        return r;
+    }
+sprintf (gbuf, "%d", count);
+sim_timer_hold (TRUE);                                  /* run flat out */
+start_gtime = sim_gtime ();
+start_events = sim_events;
+start_rbytes = sim_fio_rbytes;
+start_wbytes = sim_fio_wbytes;
+start_ms = sim_os_msec ();
+start_clock = clock ();
+sim_switches = 0;
+r = run_cmd (RU_STEP, gbuf);                            /* execute workload */
+cpu_ms = (1000.0 * (double)(clock () - start_clock)) / CLOCKS_PER_SEC;
+elapsed_ms = sim_os_msec () - start_ms;
+sim_timer_hold (FALSE);
+cycles = sim_gtime () - start_gtime;
+events = sim_events - start_events;
+rbytes = sim_fio_rbytes - start_rbytes;
+wbytes = sim_fio_wbytes - start_wbytes;
+secs = (elapsed_ms ? elapsed_ms : 1) / 1000.0;
+r = SCPE_BARE_STATUS(r);
+if (r == SCPE_STEP)
+    status = "complete";
+else if (r >= SCPE_BASE)
+    status = sim_error_text (r);
+else if (sim_stop_messages[r] != NULL)
+    status = sim_stop_messages[r];
+else status = "simulator stop";
+sim_printf ("benchmark.simulator=%s\n", sim_name);
+sim_printf ("benchmark.status=%s\n", status);
+sim_printf ("benchmark.cycles=%.0f\n", cycles);
+sim_printf ("benchmark.elapsed_ms=%u\n", elapsed_ms);
+sim_printf ("benchmark.host_cpu_ms=%.0f\n", cpu_ms);
+sim_printf ("benchmark.cycles_per_sec=%.0f\n", cycles / secs);
+sim_printf ("benchmark.events=%.0f\n", events);
+sim_printf ("benchmark.events_per_sec=%.0f\n", events / secs);
+sim_printf ("benchmark.io_read_bytes=%.0f\n", rbytes);
+sim_printf ("benchmark.io_write_bytes=%.0f\n", wbytes);
+sim_printf ("benchmark.io_read_rate=%.0f\n", rbytes / secs);
+sim_printf ("benchmark.io_write_rate=%.0f\n", wbytes / secs);
+return ((r == SCPE_STEP) || (r < SCPE_BASE)) ? SCPE_OK : r;
+}
+
 /* run command message handler */
 
 void
@@ -8429,6 +8557,7 @@ do {
     else
         sim_interval = noqueue_time = NOQUEUE_WAIT;
     sim_debug (SIM_DBG_EVENT, sim_dflt_dev, "Processing Event for %s\n", sim_uname (uptr));
+    ++sim_events;                                       /* count events */
     AIO_EVENT_BEGIN(uptr);
     if (uptr->action != NULL)
         reason = uptr->action (uptr);
@@ -9054,6 +9183,295 @@ if (spc < SIM_BKPT_N_SPC) {
 return;
 }
 
+/* Memory allocation package.  Simulators allocate main memory with
+   sim_mem_alloc (size, maxsize) instead of calloc.  Where the host
+   supports it, the full maxsize - normally the largest memory the
+   simulated machine can have - is reserved as address space only, and
+   host pages are supplied, already zeroed, when the guest first touches
+   them.  A large configuration that the guest never fully uses costs
+   neither start-up time nor resident memory.
+
+   sim_mem_realloc (mem, size) changes the memory size.  Inside the
+   reservation this neither moves nor copies memory: growing exposes more
+   zeroed pages, and shrinking gives the host pages beyond the new size
+   back to the host, so they are zero if the memory grows again.  Beyond
+   the reservation, or where the host cannot reserve, it copies into a
+   new allocation like realloc.  sim_mem_free releases memory.
+
+   SET MEMORY HUGEPAGES asks the host to back reserved memory with huge
+   pages (Linux transparent huge pages), which cuts TLB misses when a
+   guest walks through a large memory; SET MEMORY NOHUGEPAGES turns this
+   off, and SHOW MEMORY shows what is allocated.
+
+   On Unix hosts, memory is reserved with mmap MAP_NORESERVE; on Windows,
+   it is reserved with VirtualAlloc and committed up to the current size.
+   Elsewhere, sim_mem_alloc falls back to calloc.
+*/
+
+#if defined (_WIN32)
+#include <windows.h>
+#define SIM_MEM_RESERVE 1
+#elif defined (__unix__) || defined (__APPLE__)
+#include <sys/mman.h>
+#define SIM_MEM_RESERVE 1
+#if !defined (MAP_ANONYMOUS) && defined (MAP_ANON)
+#define MAP_ANONYMOUS   MAP_ANON
+#endif
+#if !defined (MAP_NORESERVE)
+#define MAP_NORESERVE   0
+#endif
+#endif
+
+#define SIM_MEM_MAX     16                              /* max allocations */
+#define SIM_MEM_HUGE    (2 * 1024 * 1024)               /* huge page align */
+
+typedef struct {
+    uint8               *base;                          /* memory */
+    size_t              size;                           /* size in use */
+    size_t              max;                            /* size reserved */
+    t_bool              rsv;                            /* reserved by host? */
+    } SIM_MEM;
+
+static SIM_MEM sim_mem_tab[SIM_MEM_MAX];
+static t_bool sim_mem_huge = FALSE;                     /* use huge pages */
+
+static size_t sim_mem_pagesize (void)
+{
+#if defined (_WIN32)
+SYSTEM_INFO si;
+
+GetSystemInfo (&si);
+return (size_t) si.dwAllocationGranularity;
+#elif defined (SIM_MEM_RESERVE)
+return (size_t) sysconf (_SC_PAGESIZE);
+#else
+return 1;
+#endif
+}
+
+static SIM_MEM *sim_mem_find (void *mem)
+{
+int32 i;
+
+for (i = 0; i < SIM_MEM_MAX; i++) {
+    if ((mem != NULL) && (sim_mem_tab[i].base == (uint8 *) mem))
+        return &sim_mem_tab[i];
+    }
+return NULL;
+}
+
+/* Apply the huge page setting to one reservation */
+
+static t_bool sim_mem_advise (SIM_MEM *mp)
+{
+#if defined (MADV_HUGEPAGE)
+if (mp->rsv)
+    return (madvise (mp->base, mp->max,
+        sim_mem_huge? MADV_HUGEPAGE: MADV_NOHUGEPAGE) == 0);
+#endif
+return FALSE;
+}
+
+/* Reserve max bytes of zeroed address space with size bytes usable */
+
+static uint8 *sim_mem_reserve (size_t size, size_t max)
+{
+#if defined (_WIN32)
+uint8 *base;
+
+base = (uint8 *) VirtualAlloc (NULL, max, MEM_RESERVE, PAGE_NOACCESS);
+if (base == NULL)
+    return NULL;
+if ((size != 0) &&
+    (VirtualAlloc (base, size, MEM_COMMIT, PAGE_READWRITE) == NULL)) {
+    VirtualFree (base, 0, MEM_RELEASE);
+    return NULL;
+    }
+return base;
+#elif defined (SIM_MEM_RESERVE)
+uint8 *raw, *base;
+size_t lnt, lead;
+
+lnt = max + SIM_MEM_HUGE;                               /* room to align */
+raw = (uint8 *) mmap (NULL, lnt, PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+if (raw == (uint8 *) MAP_FAILED)
+    return NULL;
+base = (uint8 *) ((((size_t) raw) + SIM_MEM_HUGE - 1) & ~((size_t) SIM_MEM_HUGE - 1));
+lead = (size_t) (base - raw);
+if (lead != 0)                                          /* trim to alignment */
+    munmap (raw, lead);
+if (lnt - lead - max != 0)
+    munmap (base + max, lnt - lead - max);
+return base;
+#else
+return NULL;
+#endif
+}
+
+/* Return the pages in [size, old) to the host; they read as zero again */
+
+static void sim_mem_discard (SIM_MEM *mp, size_t size, size_t old)
+{
+size_t pg = sim_mem_pagesize ();
+size_t start = ((size + pg - 1) / pg) * pg;             /* first whole page */
+
+if (start > old)
+    start = old;
+memset (mp->base + size, 0, start - size);              /* partial page */
+if (old <= start)
+    return;
+#if defined (_WIN32)
+VirtualFree (mp->base + start, old - start, MEM_DECOMMIT);
+#elif defined (SIM_MEM_RESERVE)
+if (mmap (mp->base + start, old - start, PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0) ==
+    MAP_FAILED)
+    memset (mp->base + start, 0, old - start);          /* keep zero anyway */
+else if (sim_mem_huge)                                  /* remapped pages */
+    sim_mem_advise (mp);                                /* need advice again */
+#endif
+return;
+}
+
+/* Allocate size bytes of zeroed memory, resizable to max without moving */
+
+void *sim_mem_alloc (size_t size, size_t maxsize)
+{
+int32 i;
+SIM_MEM *mp = NULL;
+size_t pg = sim_mem_pagesize ();
+
+for (i = 0; i < SIM_MEM_MAX; i++) {                     /* find free slot */
+    if (sim_mem_tab[i].base == NULL) {
+        mp = &sim_mem_tab[i];
+        break;
+        }
+    }
+if ((mp == NULL) || (size == 0))
+    return NULL;
+if (maxsize < size)
+    maxsize = size;
+mp->max = ((maxsize + pg - 1) / pg) * pg;
+mp->base = sim_mem_reserve (size, mp->max);
+if ((mp->base == NULL) && (mp->max > size)) {           /* too big? */
+    mp->max = ((size + pg - 1) / pg) * pg;              /* try just size */
+    mp->base = sim_mem_reserve (size, mp->max);
+    }
+mp->rsv = (mp->base != NULL);
+if (!mp->rsv) {                                         /* no reservation */
+    mp->base = (uint8 *) calloc (size, 1);
+    mp->max = size;
+    if (mp->base == NULL)
+        return NULL;
+    }
+mp->size = size;
+if (sim_mem_huge)
+    sim_mem_advise (mp);
+return mp->base;
+}
+
+/* Change the size of memory; contents up to the smaller size are kept,
+   and memory above the old size is zero */
+
+void *sim_mem_realloc (void *mem, size_t size)
+{
+SIM_MEM *mp = sim_mem_find (mem);
+uint8 *nmem;
+
+if (mp == NULL)
+    return NULL;
+if (mp->rsv && (size != 0) && (size <= mp->max)) {      /* fits in place? */
+    if (size < mp->size)                                /* shrinking? */
+        sim_mem_discard (mp, size, mp->size);
+#if defined (_WIN32)
+    else if ((size > mp->size) &&
+        (VirtualAlloc (mp->base, size, MEM_COMMIT, PAGE_READWRITE) == NULL))
+        return NULL;
+#endif
+    mp->size = size;
+    return mem;
+    }
+nmem = (uint8 *) sim_mem_alloc (size, (size > mp->max)? size: mp->max);
+if (nmem == NULL)
+    return NULL;
+mp = sim_mem_find (mem);
+memcpy (nmem, mem, (size < mp->size)? size: mp->size);
+sim_mem_free (mem);
+return nmem;
+}
+
+void sim_mem_free (void *mem)
+{
+SIM_MEM *mp = sim_mem_find (mem);
+
+if (mp == NULL)
+    return;
+if (!mp->rsv)
+    free (mp->base);
+#if defined (_WIN32)
+else VirtualFree (mp->base, 0, MEM_RELEASE);
+#elif defined (SIM_MEM_RESERVE)
+else munmap (mp->base, mp->max);
+#endif
+mp->base = NULL;
+return;
+}
+
+/* Set memory options */
+
+t_stat sim_set_memory (int32 flag, char *cptr)
+{
+char gbuf[CBUFSIZE];
+int32 i;
+
+if ((cptr == NULL) || (*cptr == 0))                     /* now eol? */
+    return SCPE_2FARG;
+cptr = get_glyph (cptr, gbuf, 0);
+if (*cptr != 0)                                         /* now eol? */
+    return SCPE_2MARG;
+if (strcmp (gbuf, "NOHUGEPAGES") == 0)
+    flag = FALSE;
+else if (strcmp (gbuf, "HUGEPAGES") == 0)
+    flag = TRUE;
+else return SCPE_ARG;
+#if !defined (MADV_HUGEPAGE)
+if (flag)
+    return sim_messagef (SCPE_NOFNC, "Huge pages are not available on this host\n");
+#endif
+sim_mem_huge = flag;
+for (i = 0; i < SIM_MEM_MAX; i++) {                     /* apply to all */
+    if (sim_mem_tab[i].base != NULL)
+        sim_mem_advise (&sim_mem_tab[i]);
+    }
+return SCPE_OK;
+}
+
+/* Show memory allocations */
+
+t_stat sim_show_memory (FILE *st, DEVICE *dptr, UNIT *uptr, int32 flag, char *cptr)
+{
+int32 i, n;
+
+if (cptr && (*cptr != 0))
+    return SCPE_2MARG;
+fprintf (st, "Huge pages are %sabled\n", sim_mem_huge? "en": "dis");
+for (i = n = 0; i < SIM_MEM_MAX; i++) {
+    SIM_MEM *mp = &sim_mem_tab[i];
+
+    if (mp->base == NULL)
+        continue;
+    fprintf (st, "  %.0f bytes in use, ", (double) mp->size);
+    if (mp->rsv)
+        fprintf (st, "%.0f bytes reserved\n", (double) mp->max);
+    else fprintf (st, "allocated at full size\n");
+    n++;
+    }
+if (n == 0)
+    fprintf (st, "  No memory is allocated through SCP\n");
+return SCPE_OK;
+}
+
 /* Expect package.  This code provides a mechanism to stop and control simulator
    execution based on traffic coming out of simulated ports and as well as a means
    to inject data into those ports.  It can conceptually viewed as a string 
@@ -180,6 +180,9 @@ uint32 sim_brk_test (t_addr bloc, uint32 btyp);
 void sim_brk_clrspc (uint32 spc);
 char *sim_brk_clract (void);
 void sim_brk_setact (const char *action);
+void *sim_mem_alloc (size_t size, size_t maxsize);
+void *sim_mem_realloc (void *mem, size_t size);
+void sim_mem_free (void *mem);
 t_stat sim_send_input (SEND *snd, uint8 *data, size_t size, uint32 after, uint32 delay);
 t_stat sim_show_send_input (FILE *st, SEND *snd);
 t_bool sim_send_poll_data (SEND *snd, t_stat *stat);
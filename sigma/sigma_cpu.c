@@ -248,6 +248,7 @@ extern uint32 io_tio (uint32 rn, uint32 bva);
 extern uint32 io_tdv (uint32 rn, uint32 bva);
 extern uint32 io_hio (uint32 rn, uint32 bva);
 extern uint32 io_aio (uint32 rn, uint32 bva);
+extern uint32 *map_ifc[VA_NUM_PAG];
 extern uint32 int_reset (DEVICE *dev);
 extern void io_set_eimax (uint32 lnt);
 extern void io_sclr_req (uint32 inum, uint32 val);
@@ -410,7 +411,7 @@ cpu_var_t cpu_tab[] = {
 
 t_stat sim_instr (void)
 {
-uint32 ir, rpc, old_PC;
+uint32 ir, rpc, old_PC, vpag;
 t_stat reason, tr, tr2;
 
 /* Restore register state */
@@ -418,6 +419,7 @@ t_stat reason, tr, tr2;
 if (io_init ())                                         /* init IO; conflict? */
     return STOP_INVIOC;
 reason = 0;
+map_cache_flush ();                                     /* maps may be new */
 if (cpu_new_PSD (1, PSW1, PSW2))                        /* restore PSD, RP etc */
     return STOP_INVPSD;
 int_hireq = io_eval_int ();
@@ -478,7 +480,13 @@ while (reason == 0) {                                   /* loop until stop */
             rpc = (PSW2 & PSW2_EA) | (PC & ~PSW1_XA);   /* 22b phys address */
         else rpc = PC;                                  /* standard 17b PC */
         PC = cpu_add_PC (old_PC = PC, 1);               /* increment PC */
-        if (((tr = ReadW (rpc << 2, &ir, VI)) != 0) ||  /* fetch inst, err? */
+        vpag = rpc >> WA_V_PAG;                         /* virt page num */
+        if ((vpag < VA_NUM_PAG) && (map_ifc[vpag] != NULL)) {
+            ir = map_ifc[vpag][rpc & WA_M_OFF];         /* cached page */
+            tr = 0;
+            }
+        else tr = ReadW (rpc << 2, &ir, VI);            /* fetch inst */
+        if ((tr != 0) ||                                /* fetch err? */
             ((tr = cpu_one_inst (rpc, ir)) != 0)) {     /* exec inst, error? */
             if (tr & TR_FL) {                           /* trap? */
                 PC = old_PC;                            /* roll back PC */
@@ -2403,11 +2411,15 @@ return 0;
 
 uint32 cpu_new_PSD (uint32 lrp, uint32 p1, uint32 p2)
 {
-uint32 tr;
+uint32 tr, old_mode;
 
+old_mode = (PSW1 & (PSW1_MM|PSW1_MS)) | (PSW2 & (PSW2_MA9|PSW2_MA5X0));
 PSW1 = p1 & ~cpu_tab[cpu_model].psw1_mbz;               /* clear mbz bits */
 PSW2 = ((p2 & ~PSW2_RP) | (PSW2 & PSW2_RP)) &           /* save reg ptr */
     ~cpu_tab[cpu_model].psw2_mbz;
+if (old_mode != ((PSW1 & (PSW1_MM|PSW1_MS)) |           /* mapping or */
+    (PSW2 & (PSW2_MA9|PSW2_MA5X0))))                    /* protection chg? */
+    map_cache_flush ();                                 /* flush fetch caches */
 if (lrp &&                                              /* load reg ptr? */
     ((tr = cpu_new_RP (p2)) != 0))                      /* invalid? */
     return tr;                                          /* trap */
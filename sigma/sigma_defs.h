@@ -315,6 +315,8 @@ typedef struct {
 #define BPA_V_PAG       (BVA_V_PAG)                     /* phys page */
 #define BPA_M_PAG       0x1FFF
 #define BPA_GETPAG(x)   (((x) >> BPA_V_PAG) & BPA_M_PAG)
+#define WA_V_PAG        (BVA_V_PAG - 2)                 /* word addr page */
+#define WA_M_OFF        (BVA_M_OFF >> 2)
 
 /* Memory maps */
 
@@ -478,5 +480,6 @@ uint32 WritePB (uint32 ba, uint32 dat);
 uint32 ReadPW (uint32 pa, uint32 *dat);
 uint32 WritePW (uint32 pa, uint32 dat);
 uint32 ReadHist (uint32 bva, uint32 *dat, uint32 *dat1, uint32 acc, uint32 lnt);
+void map_cache_flush (void);
 
 #endif
\ No newline at end of file
@@ -1103,6 +1103,8 @@ else {                                                  /* write direct */
     else if (QCPU_5X0 && ((fnc & 0xFC0) == 0x300))      /* 5X0 only */
         s5x0_ireg[fnc & 0x1F] = dat;                    /* write int reg */
     else return (stop_op)? STOP_ILLEG: 0;
+    if ((fnc == 0x046) || (fnc == 0x047))               /* mode altered chg? */
+        map_cache_flush ();                             /* access may differ */
     }
 return 0;
 }
@@ -67,6 +67,8 @@ typedef struct {
 uint16 mmc_rel[VA_NUM_PAG];
 uint8 mmc_acc[VA_NUM_PAG];
 uint8 mmc_wlk[PA_NUM_PAG];
+uint32 *map_ifc[VA_NUM_PAG];                            /* inst fetch cache */
+uint32 *map_rdc[VA_NUM_PAG];                            /* read cache */
 
 uint32 mem_sr0[NUM_MUNITS];
 uint32 mem_sr1[NUM_MUNITS];
@@ -161,14 +163,26 @@ return 0;
 
 uint32 ReadW (uint32 bva, uint32 *dat, uint32 acc)
 {
-uint32 bpa, tr;
+uint32 bpa, tr, vpag;
 
+vpag = bva >> BVA_V_PAG;                                /* virt page num */
 if (bva < BVA_REG)                                      /* register access */
     *dat = R[bva >> 2];
+else if ((vpag < VA_NUM_PAG) &&                         /* page cached for */
+    (((acc == VR) && (map_rdc[vpag] != NULL)) ||        /* read or */
+     ((acc == VI) && (map_ifc[vpag] != NULL))))         /* inst fetch? */
+    *dat = map_rdc[vpag][(bva >> 2) & WA_M_OFF];
 else {                                                  /* memory access */
     if ((tr = map_reloc (bva, acc, &bpa)) != 0)         /* relocate addr */
         return tr;
     *dat = M[bpa >> 2];
+    if (((acc == VR) || (acc == VI)) &&                 /* checked read, */
+        (vpag != 0) && (vpag < VA_NUM_PAG) &&           /* cacheable page, */
+        !BPA_IS_NXM (bpa | BVA_M_OFF)) {                /* all of it exists? */
+        map_rdc[vpag] = M + ((bpa & ~BVA_M_OFF) >> 2);  /* cache page */
+        if (acc == VI)
+            map_ifc[vpag] = map_rdc[vpag];
+        }
     }                                                   /* end else memory */
 return 0;
 }
@@ -282,6 +296,32 @@ switch (lnt) {                                          /* case on length */
 return SCPE_IERR;
 }
 
+/* Fetch and read caches
+
+   Every instruction fetch and operand read goes through the relocation
+   map, the access controls and the memory size check.  While the PSD mode
+   bits and the maps are unchanged, a page that passed those checks once
+   will pass them again, so the first successful fetch or read from a
+   virtual page saves a host pointer to the page, in map_ifc for an
+   instruction fetch (which implies read access) and in map_rdc for
+   either (a page in map_ifc is always in map_rdc too).  sim_instr fetches
+   through map_ifc directly, and ReadW uses whichever cache matches the
+   access, until the caches are flushed.
+
+   The caches hold addresses, not memory contents, so stores and I/O
+   transfers need not touch them.  They are flushed when the PSD mode
+   bits, the mode altered bits or the maps change.  Page 0 is never
+   cached, because its first locations are the general registers, and
+   neither are addresses beyond the 17b virtual space (Sigma 9 real
+   extended mode). */
+
+void map_cache_flush (void)
+{
+memset (map_ifc, 0, sizeof (map_ifc));
+memset (map_rdc, 0, sizeof (map_rdc));
+return;
+}
+
 /* Specialized virtual read and write word routines -
    treats all addresses as memory addresses */
 
@@ -446,8 +486,10 @@ if ((map_width == 0) ||                                 /* validate map */
     }
 do {
     cs = (R[rn|1] >> MMC_V_CS) & map_cmask;             /* ptr into map */
-    if ((tr = ReadW ((R[rn] << 2) & BVAMASK, &wd, VR)) != 0)
+    if ((tr = ReadW ((R[rn] << 2) & BVAMASK, &wd, VR)) != 0) {
+        map_cache_flush ();                             /* maps changed */
         return tr;
+        }
     for (i = 0; i < maps_per_word; i++) {               /* loop thru word */
         wd = ((wd << map_width) | (wd >> (32 - map_width))) & WMASK;
         switch (map) {
@@ -471,6 +513,7 @@ do {
         (((MMC_GETCNT (R[rn|1]) - 1) & MMC_M_CNT) << MMC_V_CNT) |
         ((cs & map_cmask) << MMC_V_CS);
     } while (MMC_GETCNT (R[rn|1]) != 0);
+map_cache_flush ();                                     /* maps changed */
 return SCPE_OK;
 }
 
@@ -587,5 +630,6 @@ for (i = 0; i < VA_NUM_PAG; i++) {                      /* clear mmc arrays */
     }
 for (i = 0; i < PA_NUM_PAG; i++)
     mmc_wlk[i] = 0;
+map_cache_flush ();
 return SCPE_OK;
 }
@@ -64,6 +64,8 @@
 t_bool sim_end;                     /* TRUE = little endian, FALSE = big endian */
 t_bool sim_taddr_64;                /* t_addr is > 32b and Large File Support available */
 t_bool sim_toffset_64;              /* Large File (>2GB) file I/O Support available */
+double sim_fio_rbytes = 0;          /* bytes read via sim_fread */
+double sim_fio_wbytes = 0;          /* bytes written via sim_fwrite */
 
 /* OS-independent, endian independent binary I/O package
 
@@ -119,6 +121,7 @@ size_t c;
 if ((size == 0) || (count == 0))                        /* check arguments */
     return 0;
 c = fread (bptr, size, count, fptr);                    /* read buffer */
+sim_fio_rbytes += (double)(c * size);                   /* count bytes */
 if (sim_end || (size == sizeof (char)) || (c == 0))     /* le, byte, or err? */
     return c;                                           /* done */
 sim_buf_swap_data (bptr, size, count);
@@ -152,8 +155,11 @@ unsigned char *sim_flip;
 
 if ((size == 0) || (count == 0))                        /* check arguments */
     return 0;
-if (sim_end || (size == sizeof (char)))                 /* le or byte? */
-    return fwrite (bptr, size, count, fptr);            /* done */
+if (sim_end || (size == sizeof (char))) {               /* le or byte? */
+    c = fwrite (bptr, size, count, fptr);
+    sim_fio_wbytes += (double)(c * size);               /* count bytes */
+    return c;                                           /* done */
+    }
 sim_flip = (unsigned char *)malloc(FLIP_SIZE);
 if (!sim_flip)
     return 0;
@@ -176,6 +182,7 @@ for (i = (int32)nbuf; i > 0; i--) {                     /* loop on buffers */
     total = total + c;
     }
 free(sim_flip);
+sim_fio_wbytes += (double)(total * size);               /* count bytes */
 return total;
 }
 
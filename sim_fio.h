@@ -71,5 +71,7 @@ void sim_shmem_close (SHMEM *shmem);
 extern t_bool sim_taddr_64;         /* t_addr is > 32b and Large File Support available */
 extern t_bool sim_toffset_64;       /* Large File (>2GB) file I/O support */
 extern t_bool sim_end;              /* TRUE = little endian, FALSE = big endian */
+extern double sim_fio_rbytes;       /* bytes read via sim_fread */
+extern double sim_fio_wbytes;       /* bytes written via sim_fwrite */
 
 #endif
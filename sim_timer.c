@@ -73,6 +73,7 @@
                             event
    sim_timespec_diff        subtract two timespec values
    sim_timer_activate_after schedule unit for specific time
+   sim_set_timers -         set clock operating mode (SET CLOCK)
 
 
    The calibration, idle, and throttle routines are OS-independent; the _os_
@@ -102,6 +103,10 @@ static uint32 sim_throt_val = 0;
 static uint32 sim_throt_state = 0;
 static uint32 sim_throt_sleep_time = 0;
 static int32 sim_throt_wait = 0;
+static t_bool sim_timer_held = FALSE;               /* idle and throttle held off */
+static t_bool sim_fastfwd_enab = FALSE;             /* fast forward idle time */
+static uint32 sim_fastfwd_count = 0;                /* idle periods skipped */
+static double sim_fastfwd_cycles = 0.0;             /* instructions skipped */
 static UNIT *sim_clock_unit[SIM_NTIMERS] = {NULL};
 UNIT *sim_clock_cosched_queue[SIM_NTIMERS] = {NULL};
 t_bool sim_asynch_timer = 
@@ -554,6 +559,7 @@ static int32 rtc_initd[SIM_NTIMERS] = { 0 };            /* initial delay */
 static uint32 rtc_elapsed[SIM_NTIMERS] = { 0 };         /* sec since init */
 static uint32 rtc_calibrations[SIM_NTIMERS] = { 0 };    /* calibration count */
 static double rtc_clock_skew_max[SIM_NTIMERS] = { 0 };  /* asynchronous max skew */
+static t_bool rtc_fastfwd[SIM_NTIMERS] = { 0 };         /* fast forwarded this sec */
 
 UNIT sim_timer_units[SIM_NTIMERS+2];                    /* one for each timer and one for throttle */
                                                         /* plus one for an internal clock if no clocks are registered */
@@ -595,6 +601,7 @@ rtc_currd[tmr] = time;
 rtc_initd[tmr] = time;
 rtc_elapsed[tmr] = 0;
 rtc_calibrations[tmr] = 0;
+rtc_fastfwd[tmr] = FALSE;
 if (sim_calb_tmr == -1)                 /* save first initialized clock as the system timer */
     sim_calb_tmr  = tmr;
 return time;
@@ -629,6 +636,19 @@ if (sim_idle_idled) {
     sim_debug (DBG_CAL, &sim_timer_dev, "skipping calibration due to idling - result: %d\n", rtc_currd[tmr]);
     return rtc_currd[tmr];                              /* avoid calibrating idle checks */
     }
+if (rtc_fastfwd[tmr]) {                                 /* idle time skipped? */
+    /* Simulated time was advanced directly across guest idle periods */
+    /* during this second, so the elapsed wall time says nothing about */
+    /* the instruction rate.  Keep the last calibrated delay and resync */
+    /* virtual and real time so that no catch-up is attempted later.    */
+    rtc_rtime[tmr] = new_rtime;                         /* save wall time */
+    rtc_vtime[tmr] = new_rtime;                         /* sync virtual time */
+    rtc_nxintv[tmr] = 1000;                             /* reset next interval */
+    rtc_gtime[tmr] = sim_gtime();                       /* save instruction time */
+    rtc_fastfwd[tmr] = FALSE;                           /* reset flag */
+    sim_debug (DBG_CAL, &sim_timer_dev, "skipping calibration due to fast forward - result: %d\n", rtc_currd[tmr]);
+    return rtc_currd[tmr];
+    }
 if (new_rtime < rtc_rtime[tmr]) {                       /* time running backwards? */
     rtc_rtime[tmr] = new_rtime;                         /* reset wall time */
     sim_debug (DBG_CAL, &sim_timer_dev, "time running backwards - result: %d\n", rtc_currd[tmr]);
@@ -766,7 +786,13 @@ int tmr, clocks;
 
 fprintf (st, "Minimum Host Sleep Time:       %dms\n", sim_os_sleep_min_ms);
 fprintf (st, "Host Clock Resolution:         %dms\n", sim_os_clock_resoluton_ms);
-fprintf (st, "Time before Clock Calibration: %d seconds\n\n", sim_idle_stable);
+fprintf (st, "Time before Clock Calibration: %d seconds\n", sim_idle_stable);
+if (sim_fastfwd_enab) {
+    fprintf (st, "Idle Fast Forward:             enabled\n");
+    fprintf (st, "  Idle Periods Skipped:        %u\n", sim_fastfwd_count);
+    fprintf (st, "  Instructions Skipped:        %.0f\n", sim_fastfwd_cycles);
+    }
+fprintf (st, "\n");
 for (tmr=clocks=0; tmr<SIM_NTIMERS; ++tmr) {
     if (0 == rtc_initd[tmr])
         continue;
@@ -862,6 +888,8 @@ REG sim_timer_reg[] = {
     { DRDATAD (THROT_STATE,      sim_throt_state,        32, ""), PV_RSPC|REG_RO},
     { DRDATAD (THROT_SLEEP_TIME, sim_throt_sleep_time,   32, ""), PV_RSPC|REG_RO},
     { DRDATAD (THROT_WAIT,       sim_throt_wait,         32, ""), PV_RSPC|REG_RO},
+    { FLDATAD (FASTFWD_ENAB,     sim_fastfwd_enab,        0, "Idle Fast Forward Enabled"), REG_RO},
+    { DRDATAD (FASTFWD_COUNT,    sim_fastfwd_count,      32, "Idle Periods Skipped"), PV_RSPC|REG_RO},
     { NULL }
     };
 
@@ -929,7 +957,8 @@ static uint32 cyc_ms = 0;
 uint32 w_ms, w_idle, act_ms;
 int32 act_cyc;
 
-if ((!sim_idle_enab)                             ||     /* idling disabled */
+if (((!sim_idle_enab) && (!sim_fastfwd_enab))   ||     /* idling disabled */
+    (sim_timer_held)                             ||     /* or held off? */
     ((sim_clock_queue == QUEUE_LIST_END) &&             /* or clock queue empty? */
      (!(sim_asynch_enabled && sim_asynch_timer)))||     /*     and not asynch? */
     ((sim_clock_queue != QUEUE_LIST_END) &&             /* or clock queue not empty */
@@ -963,6 +992,23 @@ if ((!sim_idle_enab)                             ||     /* idling disabled */
    */
 //sim_idle_idled = TRUE;                                  /* record idle attempt */
 sim_debug (DBG_TRC, &sim_timer_dev, "sim_idle(tmr=%d, sin_cyc=%d)\n", tmr, sin_cyc);
+if (sim_fastfwd_enab &&                                 /* fast forwarding */
+    (sim_clock_queue != QUEUE_LIST_END)) {              /*   to a known event? */
+    /* Rather than sleeping, advance simulated time directly to the next */
+    /* pending event.  The skipped interval is credited to sim_time when */
+    /* the event is processed, and calibration for the current second is */
+    /* suppressed so the tick rate seen by the guest is not inflated.   */
+    int32 i;
+
+    sim_debug (DBG_IDL, &sim_timer_dev, "fast forwarding %d instructions to event on %s\n", sim_interval, sim_uname(sim_clock_queue));
+    if (sim_interval > 0)
+        sim_fastfwd_cycles += sim_interval;
+    ++sim_fastfwd_count;
+    for (i = 0; i < SIM_NTIMERS; i++)
+        rtc_fastfwd[i] = TRUE;
+    sim_interval = 0;                                   /* fire immediately */
+    return TRUE;
+    }
 if (cyc_ms == 0)                                        /* not computed yet? */
     cyc_ms = (rtc_currd[tmr] * rtc_hz[tmr]) / 1000;     /* cycles per msec */
 if ((sim_idle_rate_ms == 0) || (cyc_ms == 0)) {         /* not possible? */
@@ -1047,6 +1093,52 @@ if (sim_switches & SWMASK ('D'))
 return SCPE_OK;
 }
 
+/* Set clock operating mode
+
+   SET CLOCK FASTFORWARD causes idle periods to be skipped by advancing
+   simulated time directly to the next pending event instead of sleeping.
+   This lets unattended guests run scheduled work as fast as the host
+   permits.  Guest time remains internally consistent since the interval
+   skipped is exactly the time until the next event; wall clock
+   calibration is frozen while skipping so tick rates don't drift.
+
+   Only the idle time a simulator reports through sim_idle is skipped.
+   Many simulators (the PDP-8, PDP-10, PDP-18b, HP 2100 and VAX among them)
+   call sim_idle only when SET CPU IDLE has enabled idle detection, so
+   enabling fast forward without it prints a reminder.
+*/
+
+t_stat sim_set_timers (int32 arg, char *cptr)
+{
+char gbuf[CBUFSIZE];
+
+if ((cptr == NULL) || (*cptr == 0))
+    return SCPE_2FARG;
+while (*cptr) {
+    cptr = get_glyph (cptr, gbuf, ',');
+    if (strcmp (gbuf, "FASTFORWARD") == 0) {
+        if (sim_asynch_enabled && sim_asynch_timer) {
+            sim_printf ("Fast forward is not available with asynchronous clocks\n");
+            return SCPE_NOFNC;
+            }
+        sim_fastfwd_enab = TRUE;
+        sim_fastfwd_count = 0;
+        sim_fastfwd_cycles = 0.0;
+        if (sim_throt_type != SIM_THROT_NONE) {
+            sim_set_throt (0, NULL);
+            sim_printf ("Throttling disabled\n");
+            }
+        if (!sim_idle_enab)
+            sim_printf ("Fast forward needs idle detection; most simulators require SET CPU IDLE\n");
+        }
+    else if (strcmp (gbuf, "NOFASTFORWARD") == 0)
+        sim_fastfwd_enab = FALSE;
+    else
+        return SCPE_ARG;
+    }
+return SCPE_OK;
+}
+
 /* Throttling package */
 
 t_stat sim_set_throt (int32 arg, char *cptr)
@@ -1089,6 +1181,10 @@ else {
         sim_printf ("Idling disabled\n");
         sim_clr_idle (NULL, 0, NULL, NULL);
         }
+    if (sim_fastfwd_enab) {
+        sim_printf ("Fast forward disabled\n");
+        sim_fastfwd_enab = FALSE;
+        }
     sim_throt_val = (uint32) val;
     if (sim_throt_type == SIM_THROT_SPC) {
         if (val2 >= sim_idle_rate_ms)
@@ -1143,7 +1239,7 @@ return SCPE_OK;
 void sim_throt_sched (void)
 {
 sim_throt_state = 0;
-if (sim_throt_type)
+if (sim_throt_type && !sim_timer_held)
     sim_activate (&sim_timer_units[SIM_NTIMERS], SIM_THROT_WINIT);
 }
 
@@ -1152,6 +1248,19 @@ void sim_throt_cancel (void)
 sim_cancel (&sim_timer_units[SIM_NTIMERS]);
 }
 
+/* Hold off idling and throttling
+
+   While held, sim_idle neither sleeps nor fast forwards and the throttle
+   is not scheduled, so the simulator runs at full host speed without
+   disturbing the operator's IDLE and THROTTLE settings.  Used by
+   measurement commands such as BENCHMARK.
+*/
+
+void sim_timer_hold (t_bool hold)
+{
+sim_timer_held = hold;
+}
+
 /* Throttle service
 
    Throttle service has three distinct states used while dynamically